@@ -187,6 +187,57 @@ constexpr T positiveModulus(T n, T d, T* q = nullptr)
     return result;
 }
 
+/// @brief Calculates the floor of an integer division, even for negative dividends.
+/// @details This is the quotient returned by @ref positiveModulus, computed without branches
+/// so that loops using it can be vectorized.
+/// @tparam T An integer type.
+/// @param n The dividend (may be negative).
+/// @param d The divisor (must be positive).
+template <typename T>
+constexpr T floorDivide(T n, T d)
+{
+    static_assert(std::is_integral_v<T>, "floorDivide requires an integer type");
+    return (n / d) - T((n % d) < 0);
+}
+
+/// @brief Calculates the number of EDO divisions in a perfect fifth.
+/// @param numberOfEdoDivisions The number of divisions in the EDO. (E.g., 31-EDO would pass 31.)
+inline int calcFifthSteps(int numberOfEdoDivisions)
+{
+    // std::log(3.0 / 2.0) / std::log(2.0) is 0.5849625007211562.
+    static constexpr double kFifthsMultiplier = 0.5849625007211562;
+    return static_cast<int>(std::floor(numberOfEdoDivisions * kFifthsMultiplier) + 0.5);
+}
+
+/// @brief Calculates the EDO division of each natural note name, C first, for any EDO.
+/// @details The natural note names are generated as a chain of fifths from C, so 12-EDO returns
+/// @ref MAJOR_KEYMAP and 31-EDO returns `{ 0, 5, 10, 13, 18, 23, 28 }`. The result is suitable
+/// for @ref calcPitchClass.
+/// @param numberOfEdoDivisions The number of divisions in the EDO. (E.g., 31-EDO would pass 31.)
+inline std::array<int, STANDARD_DIATONIC_STEPS> calcNaturalKeyMap(int numberOfEdoDivisions)
+{
+    // fifths from C to each of C, D, E, F, G, A, B
+    constexpr std::array<int, STANDARD_DIATONIC_STEPS> fifthsFromC = { 0, 2, 4, -1, 1, 3, 5 };
+    const int fifthSteps = calcFifthSteps(numberOfEdoDivisions);
+    std::array<int, STANDARD_DIATONIC_STEPS> result{};
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = positiveModulus(fifthsFromC[i] * fifthSteps, numberOfEdoDivisions);
+    }
+    return result;
+}
+
+/// @brief Calculates the nearest 12-EDO MIDI key for a pitch measured in EDO divisions from middle C.
+/// @details Halves round up. The result is exact for 12-EDO. Every MIDI key computed from EDO divisions
+/// should use this function, so that all callers agree on the rounding.
+/// @param divisionsFromMiddleC The pitch in EDO divisions, where middle C is 0.
+/// @param numberOfEdoDivisions The number of divisions in the EDO. (E.g., 31-EDO would pass 31.)
+/// @return The MIDI key number, where middle C is 60.
+constexpr int calcMidiKey(int divisionsFromMiddleC, int numberOfEdoDivisions)
+{
+    constexpr int middleCMidiKey = 60;
+    return middleCMidiKey + floorDivide(STANDARD_12EDO_STEPS * 2 * divisionsFromMiddleC + numberOfEdoDivisions, 2 * numberOfEdoDivisions);
+}
+
 /// @brief Calculates the pitch class of a spelled note name.
 /// @details The pitch class is the note's chromatic position within one octave, counting from the
 /// natural note name and then applying the alteration. Enharmonics share a pitch class, so C♯ and D♭
@@ -295,13 +346,20 @@ constexpr bool calcTranspositionIsOctave(int displacement, int alteration)
 ///
 /// The way to use this class is to intialize it in the constructor, run one or more transposition functions,
 /// then extract the modified displacement and alteration values.
+///
+/// The key map is held in a fixed-size array, so a Transposer never allocates. It is intended to be
+/// constructed on the stack for each pitch calculation.
 class Transposer
 {
+public:
+    /// @brief The key map type: the starting EDO division of each diatonic step.
+    using KeyMap = std::array<int, STANDARD_DIATONIC_STEPS>;
+
 private:
     int m_displacement;
     int m_alteration;               // alteration from key signature
     int m_numberOfEdoDivisions;     // number of divisions in the EDO (default 12)
-    std::vector<int> m_keyMap;      // step map for the EDO
+    KeyMap m_keyMap;                // step map for the EDO
 
 public:
     /// @brief Constructs a 12-EDO major-scale transposer for a spelled pitch.
@@ -322,20 +380,27 @@ public:
     Transposer(int displacement, int alteration,
         bool isMinor = false, int numberOfEdoDivisions = STANDARD_12EDO_STEPS,
         const std::optional <std::vector<int>>& keyMap = std::nullopt)
-        : m_displacement(displacement), m_alteration(alteration), m_numberOfEdoDivisions(numberOfEdoDivisions)
+        : m_displacement(displacement), m_alteration(alteration), m_numberOfEdoDivisions(numberOfEdoDivisions),
+          m_keyMap(isMinor ? MINOR_KEYMAP : MAJOR_KEYMAP)
     {
         if (keyMap) {
             if (keyMap.value().size() != STANDARD_DIATONIC_STEPS) {
                 throw std::invalid_argument("The Transposer class only supports key map arrays of " + std::to_string(STANDARD_DIATONIC_STEPS) + " elements");
             }
-            m_keyMap = keyMap.value();
-        } else if (isMinor) {
-            m_keyMap.assign(MINOR_KEYMAP.begin(), MINOR_KEYMAP.end());
-        } else {
-            m_keyMap.assign(MAJOR_KEYMAP.begin(), MAJOR_KEYMAP.end());
+            std::copy(keyMap.value().begin(), keyMap.value().end(), m_keyMap.begin());
         }
     }
 
+    /// @brief Constructor function that takes a fixed-size key map. This constructor never allocates.
+    /// @param displacement     the scale step displacement value. 0 signifies the tonic in the C4 (middle-C) octave.
+    /// @param alteration       the number of EDO divisions by which the pitch is altered.
+    /// @param keyMap           a 7-element map specifying the starting EDO division of each diatonic step.
+    /// @param numberOfEdoDivisions the number of divisions in the EDO. (E.g., 31-EDO would pass 31.)
+    constexpr Transposer(int displacement, int alteration, const KeyMap& keyMap, int numberOfEdoDivisions = STANDARD_12EDO_STEPS)
+        : m_displacement(displacement), m_alteration(alteration), m_numberOfEdoDivisions(numberOfEdoDivisions), m_keyMap(keyMap)
+    {
+    }
+
     /// @brief Return the current displacement value
     int displacement() const { return m_displacement; }
 
@@ -448,14 +513,10 @@ public:
 
 private:
     int calcFifthSteps() const
-    {
-        // std::log(3.0 / 2.0) / std::log(2.0) is 0.5849625007211562.
-        static constexpr double kFifthsMultiplier = 0.5849625007211562;
-        return static_cast<int>(std::floor(m_numberOfEdoDivisions * kFifthsMultiplier) + 0.5);
-    }
+    { return music_theory::calcFifthSteps(m_numberOfEdoDivisions); }
 
     int calcScaleDegree(int interval) const
-    { return positiveModulus(interval, int(m_keyMap.size())); }
+    { return positiveModulus(interval, STANDARD_DIATONIC_STEPS); }
 
     int calcStepsBetweenScaleDegrees(int firstDisplacement, int secondDisplacement) const
     {
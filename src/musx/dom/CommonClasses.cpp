@@ -25,8 +25,10 @@
 #include <filesystem>
 #include <sstream>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cctype>
 #include <string_view>
@@ -218,7 +220,7 @@ std::optional<Cmper> importFontDefinitionInto(const DocumentPtr& target,
 
 std::string FontInfo::getName() const
 {
-    if (auto fontDef = getDocument()->getOthers()->get<others::FontDefinition>(SCORE_PARTID, fontId)) {
+    if (auto fontDef = getDocumentRef().getOthers()->get<others::FontDefinition>(SCORE_PARTID, fontId)) {
         return fontDef->name;
     }
     throw std::invalid_argument("font definition not found for font id " + std::to_string(fontId));
@@ -226,7 +228,7 @@ std::string FontInfo::getName() const
 
 void FontInfo::setFontIdByName(const std::string& name)
 {
-    auto fontDefs = getDocument()->getOthers()->getArray<others::FontDefinition>(SCORE_PARTID);
+    auto fontDefs = getDocumentRef().getOthers()->getArray<others::FontDefinition>(SCORE_PARTID);
     for (auto fontDef : fontDefs) {
         if (fontDef->name == name) {
             fontId = fontDef->getCmper();
@@ -257,7 +259,9 @@ bool FontInfo::isSame(const FontInfo& src) const
 
 std::optional<std::filesystem::path> FontInfo::calcSMuFLMetaDataPath(const std::string& fontName)
 {
+    static std::mutex cacheMutex;
     static std::unordered_map<std::string, SmuflMetadataPathCacheEntry> cache;
+    std::lock_guard<std::mutex> lock(cacheMutex);
     if (const auto it = cache.find(fontName); it != cache.end()) {
         return it->second.found ? std::make_optional(it->second.path) : std::nullopt;
     }
@@ -338,7 +342,7 @@ bool FontInfo::calcIsSMuFL() const
 
 bool FontInfo::calcIsSymbolFont() const
 {
-    if (auto fontDef = getDocument()->getOthers()->get<others::FontDefinition>(SCORE_PARTID, fontId)) {
+    if (auto fontDef = getDocumentRef().getOthers()->get<others::FontDefinition>(SCORE_PARTID, fontId)) {
         return fontDef->calcIsSymbolFont();
     }
     throw std::invalid_argument("font definition not found for font id " + std::to_string(fontId));
@@ -452,7 +456,7 @@ std::vector<unsigned> KeySignature::calcTonalCenterArrayForSharps() const
         return { 5, 2, 6, 3, 0, 4, 1, 5 };
     }
     if (!isBuiltIn()) {
-        if (auto centers = getDocument()->getOthers()->get<others::TonalCenterSharps>(SCORE_PARTID, getKeyMode())) {
+        if (auto centers = getDocumentRef().getOthers()->get<others::TonalCenterSharps>(SCORE_PARTID, getKeyMode())) {
             return centers->values;
         }
     }
@@ -466,7 +470,7 @@ std::vector<unsigned> KeySignature::calcTonalCenterArrayForFlats() const
         return { 5, 1, 4, 0, 3, 6, 2, 5 };
     }
     if (!isBuiltIn()) {
-        if (auto centers = getDocument()->getOthers()->get<others::TonalCenterFlats>(SCORE_PARTID, getKeyMode())) {
+        if (auto centers = getDocumentRef().getOthers()->get<others::TonalCenterFlats>(SCORE_PARTID, getKeyMode())) {
             return centers->values;
         }
     }
@@ -490,11 +494,11 @@ std::vector<int> KeySignature::calcAcciAmountsArray(KeyContext ctx) const
 
     if (!isBuiltIn()) {
         if (alter >= 0) {
-            if (auto amounts = getDocument()->getOthers()->get<others::AcciAmountSharps>(SCORE_PARTID, getKeyMode())) {
+            if (auto amounts = getDocumentRef().getOthers()->get<others::AcciAmountSharps>(SCORE_PARTID, getKeyMode())) {
                 return amounts->values;
             }
         } else {
-            if (auto amounts = getDocument()->getOthers()->get<others::AcciAmountFlats>(SCORE_PARTID, getKeyMode())) {
+            if (auto amounts = getDocumentRef().getOthers()->get<others::AcciAmountFlats>(SCORE_PARTID, getKeyMode())) {
                 return amounts->values;
             }
         }
@@ -514,11 +518,11 @@ std::vector<unsigned> KeySignature::calcAcciOrderArray(KeyContext ctx) const
 
     if (!isBuiltIn()) {
         if (alter >= 0) {
-            if (auto order = getDocument()->getOthers()->get<others::AcciOrderSharps>(SCORE_PARTID, getKeyMode())) {
+            if (auto order = getDocumentRef().getOthers()->get<others::AcciOrderSharps>(SCORE_PARTID, getKeyMode())) {
                 return order->values;
             }
         } else {
-            if (auto order = getDocument()->getOthers()->get<others::AcciOrderFlats>(SCORE_PARTID, getKeyMode())) {
+            if (auto order = getDocumentRef().getOthers()->get<others::AcciOrderFlats>(SCORE_PARTID, getKeyMode())) {
                 return order->values;
             }
         }
@@ -592,7 +596,7 @@ music_theory::Pitch KeySignature::calcPitch(int displacement, int alteration, Ke
 music_theory::Pitch KeySignature::calcPitchFromStaffPosition(int staffPosition, ClefIndex clefIndex, KeyContext ctx,
     std::optional<int> actualAlteration) const
 {
-    const auto& clefOptions = getDocument()->getOptions()->get<options::ClefOptions>();
+    const auto& clefOptions = getDocumentRef().getOptions()->get<options::ClefOptions>();
     if (!clefOptions) {
         throw std::invalid_argument("Document contains no clef options!");
     }
@@ -622,6 +626,7 @@ void KeySignature::setTransposition(int interval, int keyAdjustment, bool simpli
     if (!isLinear()) {
         return;
     }
+    m_pitchMemo.reset();
     m_octaveDisplacement = interval / music_theory::STANDARD_DIATONIC_STEPS;
     m_alterationOffset = 0; // suppresses transposed tone center and alteration calc
     int concertAlteration = getAlteration(KeyContext::Concert);
@@ -655,7 +660,7 @@ void KeySignature::setTransposition(const MusxInstance<others::Staff>& staff)
 std::optional<std::vector<int>> KeySignature::calcKeyMap() const
 {
     size_t tonalCenter = static_cast<size_t>(calcTonalCenterArrayForSharps()[0]);
-    auto keyMap = getDocument()->getOthers()->get<others::KeyMapArray>(SCORE_PARTID, getKeyMode());
+    auto keyMap = getDocumentRef().getOthers()->get<others::KeyMapArray>(SCORE_PARTID, getKeyMode());
     if (!keyMap || keyMap->steps.empty()) {
         return std::nullopt;
     }
@@ -692,7 +697,7 @@ std::optional<std::vector<int>> KeySignature::calcKeyMap() const
 
 int KeySignature::calcEDODivisions() const
 {
-    if (auto keyFormat = getDocument()->getOthers()->get<others::KeyFormat>(SCORE_PARTID, getKeyMode())) {
+    if (auto keyFormat = getDocumentRef().getOthers()->get<others::KeyFormat>(SCORE_PARTID, getKeyMode())) {
         return static_cast<int>(keyFormat->semitones);
     }
     return music_theory::STANDARD_12EDO_STEPS;
@@ -700,7 +705,141 @@ int KeySignature::calcEDODivisions() const
 
 std::unique_ptr<music_theory::Transposer> KeySignature::createTransposer(int displacement, int alteration) const
 {
-    return std::make_unique<music_theory::Transposer>(displacement, alteration, isMinor(), calcEDODivisions(), calcKeyMap());
+    return std::make_unique<music_theory::Transposer>(calcTransposer(displacement, alteration));
+}
+
+KeySignature::PitchMemoHolder& KeySignature::PitchMemoHolder::operator=(const PitchMemoHolder& src)
+{
+    if (this != &src) {
+        auto cache = src.load();
+        std::lock_guard<std::mutex> lock(getMutex());
+        m_cache = std::move(cache);
+    }
+    return *this;
+}
+
+std::shared_ptr<KeySignature::PitchMemoCache> KeySignature::PitchMemoHolder::get() const
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    if (!m_cache) {
+        m_cache = std::make_shared<PitchMemoCache>();
+    }
+    return m_cache;
+}
+
+std::shared_ptr<KeySignature::PitchMemoCache> KeySignature::PitchMemoHolder::load() const
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return m_cache;
+}
+
+std::mutex& KeySignature::PitchMemoHolder::getMutex() const
+{
+    // Striped by address: a mutex per holder would cost more than the cache it guards.
+    static std::array<std::mutex, 16> mutexes;
+    return mutexes[std::hash<const void*>{}(this) % mutexes.size()];
+}
+
+std::shared_ptr<KeySignature::PitchMemo> KeySignature::getPitchMemo() const
+{
+    const auto pitchMemo = m_pitchMemo.get();
+    {
+        std::lock_guard<std::mutex> lock(pitchMemo->mutex);
+        if (const auto it = pitchMemo->memos.find(key); it != pitchMemo->memos.end()) {
+            return it->second;
+        }
+    }
+    auto memo = std::make_shared<PitchMemo>();
+    memo->key = key;
+    memo->edoDivisions = calcEDODivisions();
+    memo->keyMap = isMinor() ? music_theory::MINOR_KEYMAP : music_theory::MAJOR_KEYMAP;
+    if (const auto keyMap = calcKeyMap()) {
+        if (keyMap->size() != music_theory::STANDARD_DIATONIC_STEPS) {
+            throw std::invalid_argument("The Transposer class only supports key map arrays of " + std::to_string(music_theory::STANDARD_DIATONIC_STEPS) + " elements");
+        }
+        std::copy(keyMap->begin(), keyMap->end(), memo->keyMap.begin());
+    }
+    std::lock_guard<std::mutex> lock(pitchMemo->mutex);
+    return pitchMemo->memos.emplace(key, std::move(memo)).first->second;
+}
+
+music_theory::Transposer KeySignature::calcTransposer(int displacement, int alteration) const
+{
+    const auto memo = getPitchMemo();
+    return music_theory::Transposer(displacement, alteration, memo->keyMap, memo->edoDivisions);
+}
+
+std::pair<int, int> KeySignature::calcDefaultEnharmonic(int displacement, int alteration) const
+{
+    auto createReturnVal = [&](int steps) -> std::pair<int, int> {
+        auto noteTransposer = calcTransposer(displacement, alteration);
+        noteTransposer.enharmonicTranspose(steps);
+        if (std::abs(noteTransposer.alteration()) > MAX_ALTERATIONS) {
+            return { displacement, alteration };
+        }
+        return { noteTransposer.displacement(), noteTransposer.alteration() };
+    };
+
+    if (alteration != 0) {
+        return createReturnVal(music_theory::sign(alteration));
+    }
+
+    const auto pitch = calcPitch(displacement, alteration, KeyContext::Concert);
+    auto up = music_theory::Transposer(pitch);
+    up.enharmonicTranspose(1);
+    auto down = music_theory::Transposer(pitch);
+    down.enharmonicTranspose(-1);
+
+    if (std::abs(down.alteration()) < std::abs(up.alteration())) {
+        return createReturnVal(-1);
+    }
+
+    return createReturnVal(1);
+}
+
+KeySignature::NoteSpelling KeySignature::calcNoteSpelling(int displacement, int alteration, KeyContext ctx, bool respellEnharmonic,
+    int chromaticInterval, int chromaticAlteration) const
+{
+    // Pack the inputs into a memo key. Values outside the packed ranges are simply not memoized.
+    auto fits = [](int value, int bits) {
+        return value >= -(1 << (bits - 1)) && value < (1 << (bits - 1));
+    };
+    auto pack = [](int value, int bits, int shift) {
+        return (uint64_t(uint32_t(value)) & ((uint64_t(1) << bits) - 1)) << shift;
+    };
+    const bool canMemoize = fits(displacement, 16) && fits(alteration, 16) && fits(chromaticInterval, 14) && fits(chromaticAlteration, 14);
+    const uint64_t memoKey = canMemoize
+        ? pack(displacement, 16, 0) | pack(alteration, 16, 16) | pack(chromaticInterval, 14, 32) | pack(chromaticAlteration, 14, 46)
+            | (uint64_t(respellEnharmonic) << 60) | (uint64_t(ctx == KeyContext::Written) << 61)
+        : 0;
+    const auto memo = getPitchMemo();
+    if (canMemoize) {
+        std::lock_guard<std::mutex> lock(memo->spellingsMutex);
+        if (const auto it = memo->spellings.find(memoKey); it != memo->spellings.end()) {
+            return it->second;
+        }
+    }
+
+    auto [transposedLev, transposedAlt] = respellEnharmonic
+                                        ? calcDefaultEnharmonic(displacement, alteration)
+                                        : std::pair<int, int>{ displacement, alteration };
+    if (chromaticInterval || chromaticAlteration) {
+        auto transposer = calcTransposer(transposedLev, transposedAlt);
+        transposer.chromaticTranspose(chromaticInterval, chromaticAlteration);
+        transposedLev = transposer.displacement();
+        transposedAlt = transposer.alteration();
+    }
+
+    NoteSpelling result;
+    result.displacement = transposedLev;
+    result.alteration = transposedAlt;
+    result.pitch = calcPitch(transposedLev, transposedAlt, ctx);
+    result.middleCOffset = calcTonalCenterIndex(ctx) + transposedLev + (getOctaveDisplacement(ctx) * music_theory::STANDARD_DIATONIC_STEPS);
+    if (canMemoize) {
+        std::lock_guard<std::mutex> lock(memo->spellingsMutex);
+        memo->spellings.emplace(memoKey, result);
+    }
+    return result;
 }
 
 std::optional<music_theory::DiatonicMode> KeySignature::calcDiatonicMode() const
@@ -725,25 +864,27 @@ std::optional<MusicPoint> MusicRange::nextLocation(const std::optional<StaffCmpe
 {
     std::optional<MusicPoint> result;
     const Edu endEdu = end.position.calcEduDuration();
-    if (auto currMeasure = getDocument()->getOthers()->get<others::Measure>(SCORE_PARTID, end.measureId)) {
+    const auto& timeline = getDocumentRef().getGlobalTimeline(SCORE_PARTID);
+    if (end.measureId >= 1 && end.measureId <= timeline.getMeasureCount()) {
         MeasCmper nextMeas = end.measureId;
-        const Edu maxEdu = currMeasure->calcDuration(forStaff).calcEduDuration() - 1;
+        const auto duration = forStaff ? timeline.getStaffDuration(end.measureId, forStaff.value()) : timeline.getMeasureDuration(end.measureId);
+        const Edu maxEdu = duration.calcEduDuration() - 1;
         Edu nextEdu = 0;
         if (endEdu < maxEdu) {
             nextEdu = endEdu + 1;
         } else {
             nextMeas++;
-            if (!getDocument()->getOthers()->get<others::Measure>(SCORE_PARTID, nextMeas)) {
+            if (nextMeas > timeline.getMeasureCount()) {
                 return std::nullopt;
             }
         }
         result = MusicPoint(nextMeas, util::Fraction::fromEdu(nextEdu));
     } else {
-        auto measures = getDocument()->getOthers()->getArray<others::Measure>(SCORE_PARTID);
+        auto measures = getDocumentRef().getOthers()->getArray<others::Measure>(SCORE_PARTID);
         // don't even report a range whose end measure is 1 past the end. This is common non-inclusive range logic.
         if (end.measureId > MeasCmper(measures.size() + 1)) {
             // music ranges are explicitly allowed to be beyond the end of a document, so treat this as a verbose message.
-            util::Logger::log(util::Logger::LogLevel::Verbose, "MusicRange has invalid end measure " + std::to_string(end.measureId));
+            util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "MusicRange has invalid end measure " + std::to_string(end.measureId); });
         }
     }
     return result;
@@ -763,7 +904,7 @@ TimeSignature::TimeSignature(const DocumentWeakPtr& document, int beats, Edu uni
 {
     auto tops = [&]() -> std::vector<std::vector<util::Fraction>> {
         if (hasCompositeTop) {
-            if (auto comps = getDocument()->getOthers()->get<others::TimeCompositeUpper>(SCORE_PARTID, Cmper(beats))) {
+            if (auto comps = getDocumentRef().getOthers()->get<others::TimeCompositeUpper>(SCORE_PARTID, Cmper(beats))) {
                 std::vector<std::vector<util::Fraction>> result;
                 for (const auto& nextItem : comps->items) {
                     if (nextItem->startGroup || result.empty()) {
@@ -780,7 +921,7 @@ TimeSignature::TimeSignature(const DocumentWeakPtr& document, int beats, Edu uni
     }();
     auto bots = [&]() -> std::vector<std::vector<Edu>> {
         if (hasCompositeBottom) {
-            if (auto comps = getDocument()->getOthers()->get<others::TimeCompositeLower>(SCORE_PARTID, Cmper(unit))) {
+            if (auto comps = getDocumentRef().getOthers()->get<others::TimeCompositeLower>(SCORE_PARTID, Cmper(unit))) {
                 std::vector<std::vector<Edu>>result;
                 for (const auto& nextItem : comps->items) {
                     if (nextItem->startGroup || result.empty()) {
@@ -809,7 +950,7 @@ TimeSignature::TimeSignature(const DocumentWeakPtr& document, int beats, Edu uni
 
 std::optional<char32_t> TimeSignature::getAbbreviatedSymbol() const
 {
-    auto musicChars = getDocument()->getOptions()->get<options::MusicSymbolOptions>();
+    auto musicChars = getDocumentRef().getOptions()->get<options::MusicSymbolOptions>();
     const char32_t commonTimeSymbol = musicChars ? musicChars->timeSigAbrvCommon : smufl_glyph::timeSigCommon;
     const char32_t cutTimeSymbol = musicChars ? musicChars->timeSigAbrvCut : smufl_glyph::timeSigCutCommon;
     switch (m_abbreviation) {
@@ -825,7 +966,7 @@ std::optional<char32_t> TimeSignature::getAbbreviatedSymbol() const
         case Abbreviation::NotApplicable:
             break;
     }
-    if (auto options = getDocument()->getOptions()->get<options::TimeSignatureOptions>()) {
+    if (auto options = getDocumentRef().getOptions()->get<options::TimeSignatureOptions>()) {
         if (options->timeSigDoAbrvCut && isCutTime()) {
             return cutTimeSymbol;
         } else if (options->timeSigDoAbrvCommon && isCommonTime()) {
@@ -26,18 +26,16 @@
 #include <array>
 #include <string>
 #include <string_view>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 
+#include "music_theory/music_theory.hpp"
 #include "musx/util/Fraction.h"
 #include "BaseClasses.h"
 #include "EnumClasses.h"
 
-namespace music_theory {
-class Transposer;
-enum class DiatonicMode : int;
-struct Pitch;
-} // namespace music_theory
-
 namespace musx {
 namespace dom {
 
@@ -394,8 +392,53 @@ public:
     /// @param displacement Displacement value (e.g., from @ref Note)
     /// @param alteration Alteration value (e.g., from @ref Note)
     /// @return A unique pointer to a transposer for this key.
+    /// @note Prefer #calcTransposer, which does not allocate.
     std::unique_ptr<music_theory::Transposer> createTransposer(int displacement, int alteration) const;
 
+    /// @brief Creates a transposer by value for this KeySignature instance.
+    ///
+    /// The key map and EDO divisions are looked up once per instance and reused, so this function
+    /// performs no pool lookups or heap allocations after its first call.
+    /// @param displacement Displacement value (e.g., from @ref Note)
+    /// @param alteration Alteration value (e.g., from @ref Note)
+    /// @throws std::invalid_argument if the key's custom key map does not have 7 diatonic steps.
+    [[nodiscard]]
+    music_theory::Transposer calcTransposer(int displacement, int alteration) const;
+
+    /// @struct NoteSpelling
+    /// @brief The result of spelling a key-relative pitch in this key. (See #calcNoteSpelling.)
+    struct NoteSpelling
+    {
+        int displacement{};             ///< The key-relative displacement after enharmonic respelling and chromatic transposition.
+        int alteration{};               ///< The key-relative alteration after enharmonic respelling and chromatic transposition.
+        music_theory::Pitch pitch;      ///< The spelled pitch, with its alteration relative to the natural note name.
+        int middleCOffset{};            ///< The number of diatonic steps from middle C. Add a clef's middle-C position to get a staff position.
+    };
+
+    /// @brief Calculates the default enharmonic equivalent of a key-relative pitch in this key.
+    /// @param displacement Displacement value (e.g., from @ref Note)
+    /// @param alteration Alteration value (e.g., from @ref Note)
+    /// @return The respelled displacement and alteration, or the input values if the respelling would exceed #MAX_ALTERATIONS.
+    [[nodiscard]]
+    std::pair<int, int> calcDefaultEnharmonic(int displacement, int alteration) const;
+
+    /**
+     * @brief Spells a key-relative pitch, optionally respelling and transposing it first.
+     *
+     * Results are memoized per KeySignature instance, so spelling repeated pitches in the same key is a table lookup.
+     * The memo is discarded whenever #key or the transposition changes.
+     *
+     * @param displacement Displacement value (e.g., from @ref Note)
+     * @param alteration Alteration value (e.g., from @ref Note)
+     * @param ctx Whether to use concert or written key-signature values.
+     * @param respellEnharmonic If true, the pitch is first respelled with #calcDefaultEnharmonic.
+     * @param chromaticInterval The diatonic interval of a chromatic transposition. (See @ref music_theory::Transposer::chromaticTranspose.)
+     * @param chromaticAlteration The chromatic alteration of a chromatic transposition.
+     */
+    [[nodiscard]]
+    NoteSpelling calcNoteSpelling(int displacement, int alteration, KeyContext ctx, bool respellEnharmonic = false,
+        int chromaticInterval = 0, int chromaticAlteration = 0) const;
+
     void integrityCheck(const std::shared_ptr<EnigmaBase>& ptrToThis) override
     {
         this->CommonClassBase::integrityCheck(ptrToThis);
@@ -416,6 +459,46 @@ private:
     int m_octaveDisplacement{};         ///< Displace notes by this many octaves (for transposed keys)
     int m_alterationOffset{};           ///< Offset of alteration (for transposed keys)
 
+    /// @brief Per-instance transposer settings and spelling results, computed on demand.
+    struct PitchMemo
+    {
+        uint16_t key{};                                     ///< The value of #key when the memo was created.
+        music_theory::Transposer::KeyMap keyMap{};          ///< The key map to use for transposers.
+        int edoDivisions{};                                 ///< The EDO divisions to use for transposers.
+        std::unordered_map<uint64_t, NoteSpelling> spellings; ///< Memoized results of #calcNoteSpelling.
+        mutable std::mutex spellingsMutex;                  ///< Guards #spellings.
+    };
+    /// @brief Holds the memos by #key. Copies share the holder; #setTransposition gives the instance a fresh one.
+    struct PitchMemoCache
+    {
+        std::mutex mutex;                                               ///< Guards #memos.
+        std::unordered_map<uint16_t, std::shared_ptr<PitchMemo>> memos; ///< The memo for each value of #key.
+    };
+    /// @brief Points to a #PitchMemoCache, which is allocated on first use so that keys never spelled cost nothing.
+    ///
+    /// The pointer is guarded because a const key may allocate it while another thread copies the key.
+    class PitchMemoHolder
+    {
+    public:
+        PitchMemoHolder() = default;
+        PitchMemoHolder(const PitchMemoHolder& src) : m_cache(src.load()) {}
+        PitchMemoHolder& operator=(const PitchMemoHolder& src);
+
+        /// @brief Returns the cache, allocating it if needed.
+        std::shared_ptr<PitchMemoCache> get() const;
+        /// @brief Detaches from the cache shared with copies.
+        void reset() { *this = PitchMemoHolder(); }
+
+    private:
+        std::shared_ptr<PitchMemoCache> load() const;
+        std::mutex& getMutex() const;
+
+        mutable std::shared_ptr<PitchMemoCache> m_cache;
+    };
+    PitchMemoHolder m_pitchMemo; ///< Reset by #setTransposition.
+
+    std::shared_ptr<PitchMemo> getPitchMemo() const;
+
     int getAlterationOffset(KeyContext ctx) const
     { return ctx == KeyContext::Written ? m_alterationOffset : 0; }
 
@@ -453,40 +536,27 @@ public:
  * @class LyricsSyllableInfo
  * @brief Contains the syllable information for a single syllable. (See @ref texts::LyricsTextBase)
  */
-class LyricsSyllableInfo : DocumentElementNoPart
+class LyricsSyllableInfo
 {
 public:
     std::string syllable;       ///< the syllable text with no hyphenation or font information.
-    bool hasHyphenBefore;       ///< indicates the syllable is preceded by a hyphen.
-    bool hasHyphenAfter;        ///< indicates the syllable if followed by a hyphen.
-    int strippedUnderscores;    ///< indicates the number of trailing underscores stripped (because smart word extensions convert them to word extensions).
+    bool hasHyphenBefore{};     ///< indicates the syllable is preceded by a hyphen.
+    bool hasHyphenAfter{};      ///< indicates the syllable if followed by a hyphen.
+    int strippedUnderscores{};  ///< indicates the number of trailing underscores stripped (because smart word extensions convert them to word extensions).
 
 private:
-    /**
-     * @class LyricsSyllableStyleSpan
-     * @brief Contains font style information for a lyrics syllable. (See @ref texts::LyricsSyllableInfo)
-     */
-    class StyleSpan
-    {
-    public:
-        size_t start;        // start byte
-        size_t end;          // end byte (exclusive)
-        size_t styleIndex;   // index into LyricsTextBase's style table
-    };
-
     /// @brief Constructor function
-    /// @param document Shared pointer to the document.
     /// @param text The syllable text.
+    /// @param offset The byte offset of the syllable within the style runs of the @ref texts::LyricsTextBase that created it.
     /// @param before Whether there is a hyphen before the syllable.
     /// @param after Whether there is a hyphen after the syllable.
     /// @param underscores The number of trailing underscores stripped.
-    /// @param enigmaStylesIndex The enigma style (in LyricsTextBase) for this syllable.
-    LyricsSyllableInfo(const DocumentWeakPtr& document, const std::string text, bool before, bool after, int underscores, std::vector<StyleSpan>&& enigmaStyleMap)
-        : DocumentElementNoPart(document), syllable(text), hasHyphenBefore(before), hasHyphenAfter(after), strippedUnderscores(underscores), m_enigmaStyleMap(std::move(enigmaStyleMap))
+    LyricsSyllableInfo(std::string text, size_t offset, bool before, bool after, int underscores)
+        : syllable(std::move(text)), hasHyphenBefore(before), hasHyphenAfter(after), strippedUnderscores(underscores), m_textOffset(offset)
     {
     }
 
-    std::vector<StyleSpan> m_enigmaStyleMap; ///< the enigma style (in LyricsTextBase) for this syllable.
+    size_t m_textOffset{};
 
     friend class texts::LyricsTextBase;
 };
@@ -56,20 +56,20 @@ MusxInstance<EDBASE> EntryDetailsBase::getStemDependentDetail(const EntryInfoPtr
 
     switch (stemSelection) {
     case StemSelection::UpStem:
-        return frame->getDocument()->getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber());
+        return frame->getDocumentRef().getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber());
     case StemSelection::DownStem:
-        return frame->getDocument()->getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
+        return frame->getDocumentRef().getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
     case StemSelection::MatchEntry:
         if (entryInfo.calcUpStem()) {
-            return frame->getDocument()->getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber());
+            return frame->getDocumentRef().getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber());
         } else {
-            return frame->getDocument()->getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
+            return frame->getDocumentRef().getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
         }
     case StemSelection::Any:
-        if (auto upStem = frame->getDocument()->getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber())) {
+        if (auto upStem = frame->getDocumentRef().getDetails()->get<EDUP>(frame->getRequestedPartId(), entry->getEntryNumber())) {
             return upStem;
         } else {
-            return frame->getDocument()->getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
+            return frame->getDocumentRef().getDetails()->get<EDDOWN>(frame->getRequestedPartId(), entry->getEntryNumber());
         }
     }
     return nullptr;
@@ -160,7 +160,7 @@ details::ArticulationAssign::calcSelectedSymbolContext(const EntryInfoPtr& entry
         return std::nullopt;
     }
 
-    result.definition = getDocument()->getOthers()->get<others::ArticulationDef>(getRequestedPartId(), articDef);
+    result.definition = getDocumentRef().getOthers()->get<others::ArticulationDef>(getRequestedPartId(), articDef);
     if (!result.definition) {
         return std::nullopt;
     }
@@ -185,7 +185,7 @@ NoteInfoPtr details::ArticulationAssign::calcAssociatedNote(const EntryInfoPtr&
     if (!entry->isNote || entry->notes.empty()) {
         return NoteInfoPtr();
     }
-    const auto definition = getDocument()->getOthers()->get<others::ArticulationDef>(getRequestedPartId(), articDef);
+    const auto definition = getDocumentRef().getOthers()->get<others::ArticulationDef>(getRequestedPartId(), articDef);
     if (!definition || definition->autoVert) {
         return NoteInfoPtr();
     }
@@ -314,9 +314,9 @@ Efix BeamAlterations::calcEffectiveBeamWidth() const
     if (getInci().has_value()) { // secondary beams have incis; primary beams do not
         MusxInstance<BeamAlterations> primary;
         if (dynamic_cast<const SecondaryBeamAlterationsDownStem*>(this)) {
-            primary = getDocument()->getDetails()->get<BeamAlterationsDownStem>(getRequestedPartId(), getEntryNumber());
+            primary = getDocumentRef().getDetails()->get<BeamAlterationsDownStem>(getRequestedPartId(), getEntryNumber());
         } else {
-            primary = getDocument()->getDetails()->get<BeamAlterationsUpStem>(getRequestedPartId(), getEntryNumber());
+            primary = getDocumentRef().getDetails()->get<BeamAlterationsUpStem>(getRequestedPartId(), getEntryNumber());
         }
         if (primary) {
             return primary->calcEffectiveBeamWidth();
@@ -327,7 +327,7 @@ Efix BeamAlterations::calcEffectiveBeamWidth() const
         }
     }
     Efix result = 0;
-    if (const auto beamOptions = getDocument()->getOptions()->get<options::BeamOptions>()) {
+    if (const auto beamOptions = getDocumentRef().getOptions()->get<options::BeamOptions>()) {
         result = beamOptions->beamWidth;
     } else {
         MUSX_INTEGRITY_ERROR("Unable to retrieve beaming options. Beam width value returned is zero.");
@@ -405,7 +405,7 @@ MusxInstanceList<SecondaryBeamType> BeamAlterations::getSecondaryBeamArray(const
         "SecondaryBeamType must be a secondary beam type.");
 
     auto frame = entryInfo.getFrame();
-    return frame->getDocument()->getDetails()->getArray<SecondaryBeamType>(frame->getRequestedPartId(), entryInfo->getEntry()->getEntryNumber());
+    return frame->getDocumentRef().getDetails()->getArray<SecondaryBeamType>(frame->getRequestedPartId(), entryInfo->getEntry()->getEntryNumber());
 }
 
 #ifndef DOXYGEN_SHOULD_IGNORE_THIS
@@ -504,14 +504,14 @@ Cmper ChordAssign::calcFretboardGroupCmper() const
 
 MusxInstanceList<others::ChordSuffixElement> ChordAssign::getChordSuffix() const
 {
-    return getDocument()->getOthers()->getArray<others::ChordSuffixElement>(getRequestedPartId(), suffixId);
+    return getDocumentRef().getOthers()->getArray<others::ChordSuffixElement>(getRequestedPartId(), suffixId);
 }
 
 MusxInstance<others::FretboardGroup> ChordAssign::getFretboardGroup() const
 {
     const Cmper groupCmper = calcFretboardGroupCmper();
     if (!useFretboardFont && groupCmper != 0) {
-        return getDocument()->getOthers()->get<others::FretboardGroup>(getRequestedPartId(), groupCmper, fretboardGroupInci);
+        return getDocumentRef().getOthers()->get<others::FretboardGroup>(getRequestedPartId(), groupCmper, fretboardGroupInci);
     }
     return nullptr;
 }
@@ -519,7 +519,7 @@ MusxInstance<others::FretboardGroup> ChordAssign::getFretboardGroup() const
 MusxInstance<others::FretboardStyle> ChordAssign::getFretboardStyle() const
 {
     if (!useFretboardFont && fbStyleId != 0) {
-        return getDocument()->getOthers()->get<others::FretboardStyle>(getRequestedPartId(), fbStyleId);
+        return getDocumentRef().getOthers()->get<others::FretboardStyle>(getRequestedPartId(), fbStyleId);
     }
     return nullptr;
 }
@@ -531,7 +531,7 @@ MusxInstance<others::FretboardStyle> ChordAssign::getFretboardStyle() const
 bool CustomStem::calcIsHiddenStem() const
 {
     if (shapeDef != 0) {
-        if (const auto shape = getDocument()->getOthers()->get<others::ShapeDef>(getRequestedPartId(), shapeDef)) {
+        if (const auto shape = getDocumentRef().getOthers()->get<others::ShapeDef>(getRequestedPartId(), shapeDef)) {
             return shape->isBlank();
         }
     }
@@ -555,7 +555,7 @@ std::pair<MusxInstance<others::Frame>, Edu> details::GFrameHold::findLayerFrame(
     MusxInstance<others::Frame> layerFrame;
     Edu startEdu = 0;
     if (layerIndex < frames.size() && frames[layerIndex]) {
-        auto frameIncis = getDocument()->getOthers()->getArray<others::Frame>(getRequestedPartId(), frames[layerIndex]);
+        auto frameIncis = getDocumentRef().getOthers()->getArray<others::Frame>(getRequestedPartId(), frames[layerIndex]);
         for (const auto& frame : frameIncis) {
             if (frame->startEntry) {
                 if (layerFrame) {
@@ -610,17 +610,17 @@ MusxInstance<TimeSignature> IndependentStaffDetails::createDisplayTimeSignature(
 
 MusxInstance<texts::LyricsTextBase> LyricAssignVerse::getLyricText() const
 {
-    return getDocument()->getTexts()->get<TextType>(lyricNumber);
+    return getDocumentRef().getTexts()->get<TextType>(lyricNumber);
 }
 
 MusxInstance<texts::LyricsTextBase> LyricAssignChorus::getLyricText() const
 {
-    return getDocument()->getTexts()->get<TextType>(lyricNumber);
+    return getDocumentRef().getTexts()->get<TextType>(lyricNumber);
 }
 
 MusxInstance<texts::LyricsTextBase> LyricAssignSection::getLyricText() const
 {
-    return getDocument()->getTexts()->get<TextType>(lyricNumber);
+    return getDocumentRef().getTexts()->get<TextType>(lyricNumber);
 }
 
 LyricTextType LyricAssignVerse::getLyricTextType() const
@@ -652,21 +652,7 @@ EntryInfoPtr LyricAssign::calcWordExtensionEndpoint() const
     if (!wext) {
         return {};
     }
-    const auto doc = getDocument();
-    if (auto lyricOptions = doc->getOptions()->get<options::LyricOptions>()) {
-        if (!lyricOptions->useSmartHyphens) {
-            return {};
-        }
-    }
-    auto wordExtShapeAssigns = doc->getDetails()->getArray<SmartShapeEntryAssign>(getRequestedPartId(), getEntryNumber());
-    for (const auto& assign : wordExtShapeAssigns) {
-        if (auto shape = doc->getOthers()->get<others::SmartShape>(getRequestedPartId(), assign->shapeNum)) {
-            if (shape->shapeType == others::SmartShape::ShapeType::WordExtension && shape->startLyricType == getLyricTextType() && shape->startLyricNum == lyricNumber) {
-                return shape->endTermSeg->endPoint->calcAssociatedEntry();
-            }
-        }
-    }
-    return {};
+    return getDocumentRef().getLyricIndex(getRequestedPartId()).getWordExtensionEndpoint(getLyricTextType(), lyricNumber, getEntryNumber());
 }
 
 // *****************************
@@ -675,13 +661,13 @@ EntryInfoPtr LyricAssign::calcWordExtensionEndpoint() const
 
 MusxInstance<others::TextBlock> MeasureTextAssign::getTextBlock() const
 {
-    return getDocument()->getOthers()->get<others::TextBlock>(getRequestedPartId(), block);
+    return getDocumentRef().getOthers()->get<others::TextBlock>(getRequestedPartId(), block);
 }
 
 util::EnigmaParsingContext MeasureTextAssign::getRawTextCtx(Cmper forPartId) const
 {
     if (auto textBlock = getTextBlock()) {
-        if (const auto page = getDocument()->calcPageFromMeasure(forPartId, getCmper2())) {
+        if (const auto page = getDocumentRef().calcPageFromMeasure(forPartId, getCmper2())) {
             return textBlock->getRawTextCtx(forPartId, page->getCmper());
         }
     }
@@ -694,7 +680,7 @@ util::EnigmaParsingContext MeasureTextAssign::getRawTextCtx(Cmper forPartId) con
 
 util::EnigmaParsingContext StaffGroup::getFullNameCtx() const
 {
-    if (auto textBlock = getDocument()->getOthers()->get<others::TextBlock>(getRequestedPartId(), fullNameId)) {
+    if (auto textBlock = getDocumentRef().getOthers()->get<others::TextBlock>(getRequestedPartId(), fullNameId)) {
         return textBlock->getRawTextCtx(getRequestedPartId());
     }
     return {};
@@ -710,7 +696,7 @@ std::string StaffGroup::getFullName(util::EnigmaString::AccidentalStyle accident
 
 util::EnigmaParsingContext StaffGroup::getAbbreviatedNameCtx() const
 {
-    if (auto textBlock = getDocument()->getOthers()->get<others::TextBlock>(getRequestedPartId(), abbrvNameId)) {
+    if (auto textBlock = getDocumentRef().getOthers()->get<others::TextBlock>(getRequestedPartId(), abbrvNameId)) {
         return textBlock->getRawTextCtx(getRequestedPartId());
     }
     return {};
@@ -727,7 +713,7 @@ std::string StaffGroup::getAbbreviatedName(util::EnigmaString::AccidentalStyle a
 MusxInstance<others::MultiStaffInstrumentGroup> StaffGroup::getMultiStaffInstGroup() const
 {
     if (multiStaffGroupId) {
-        if (auto retval = getDocument()->getOthers()->get<others::MultiStaffInstrumentGroup>(SCORE_PARTID, multiStaffGroupId)) {
+        if (auto retval = getDocumentRef().getOthers()->get<others::MultiStaffInstrumentGroup>(SCORE_PARTID, multiStaffGroupId)) {
             return retval;
         }
         MUSX_INTEGRITY_ERROR("StaffGroup " + std::to_string(getCmper2()) + " points to non-existent MultiStaffInstrumentGroup " + std::to_string(multiStaffGroupId));
@@ -882,8 +868,8 @@ std::vector<StaffGroupInfo> StaffGroupInfo::getGroupsAtMeasure(MeasCmper measure
     const MusxInstanceList<others::StaffUsed>& systemStaves)
 {
     if (systemStaves.empty()) {
-        util::Logger::log(util::Logger::LogLevel::Info, "Attempted to find groups for empty system staves. [measure " + std::to_string(measureId)
-            + ", part " + std::to_string(linkedPartId) +"] Returning an empty vector.");
+        util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Attempted to find groups for empty system staves. [measure " + std::to_string(measureId)
+            + ", part " + std::to_string(linkedPartId) +"] Returning an empty vector."; });
         return {};
     }
     const auto doc = systemStaves.getDocument();
@@ -908,9 +894,9 @@ MusxInstance<TieAlterBase> TieAlterBase::fromNoteInfo(const NoteInfoPtr& noteInf
 {
     const auto entry = noteInfoPtr.getEntryInfo()->getEntry();
     if (forTieEnd) {
-        return entry->getDocument()->getDetails()->getForNote<TieAlterEnd>(noteInfoPtr);
+        return entry->getDocumentRef().getDetails()->getForNote<TieAlterEnd>(noteInfoPtr);
     }
-    return entry->getDocument()->getDetails()->getForNote<TieAlterStart>(noteInfoPtr);
+    return entry->getDocumentRef().getDetails()->getForNote<TieAlterStart>(noteInfoPtr);
 }
 
 } // namespace details
@@ -1294,7 +1294,7 @@ public:
         DetailsBase::integrityCheck(ptrToThis);
         if (std::abs(getAlterationValue()) > MAX_ALTERATIONS) {
             util::Logger::log(util::Logger::LogLevel::Verbose,
-                "KeySymbolListElement for list " + std::to_string(getCmper1()) + " has invalid value " + std::to_string(getAlterationValue()));
+                [&]() { return "KeySymbolListElement for list " + std::to_string(getCmper1()) + " has invalid value " + std::to_string(getAlterationValue()); });
         }
     }
 
@@ -1703,8 +1703,8 @@ public:
         if (!mask) {
             mask = unsigned(NoteType::Note4096th);
             util::Logger::log(util::Logger::LogLevel::Verbose,
-                "Secondary beam break for entry " + std::to_string(getEntryNumber())
-                + " has no breaks; the 4096th-note beam was assumed.");
+                [&]() { return "Secondary beam break for entry " + std::to_string(getEntryNumber())
+                + " has no breaks; the 4096th-note beam was assumed."; });
         }
         if (mask >= unsigned(NoteType::Eighth)) {
             mask = unsigned(NoteType::Eighth) - 1;
@@ -1924,8 +1924,8 @@ public:
             // the staff groups can get a bit squirrelly. Groups like this should just
             // be ignored.                
             util::Logger::log(util::Logger::LogLevel::Info,
-                "Staff group " + std::to_string(getCmper2()) + " for part " + std::to_string(getSourcePartId())
-                + " starts at measure " + std::to_string(startMeas) + " and ends at measure " + std::to_string(endMeas));
+                [&]() { return "Staff group " + std::to_string(getCmper2()) + " for part " + std::to_string(getSourcePartId())
+                + " starts at measure " + std::to_string(startMeas) + " and ends at measure " + std::to_string(endMeas); });
         }
         if (!bracket) {
             // this is not an error. Finale omits the bracket node for groups with entirely default bracket info.
@@ -25,6 +25,7 @@
 #include <cstring>
 #include <filesystem>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,6 +124,35 @@ std::optional<std::filesystem::path> resolveMacAliasData(const std::vector<std::
     return resolveMacBookmarkData(bytes);
 }
 #endif
+
+/// Returns the cached value for @p key, building it if absent. The build runs without the lock held
+/// because builders may use other lazy caches; if two threads race, the first value stored wins.
+template <typename T, typename Build>
+const T& findOrBuild(std::mutex& mutex, std::unordered_map<Cmper, std::shared_ptr<const T>>& cache, Cmper key, Build&& build)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (const auto it = cache.find(key); it != cache.end() && it->second) {
+            return *it->second;
+        }
+    }
+    std::shared_ptr<const T> built = build();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& result = cache[key];
+    if (!result) {
+        result = std::move(built);
+    }
+    return *result;
+}
+
+void sortTupletsByReferenceDuration(std::vector<MusxInstance<details::TupletDef>>& tuplets)
+{
+    if (tuplets.size() > 1) {
+        std::stable_sort(tuplets.begin(), tuplets.end(), [](const auto& a, const auto& b) {
+            return a->calcReferenceDuration() > b->calcReferenceDuration();
+        });
+    }
+}
 } // namespace
 #endif // DOXYGEN_SHOULD_IGNORE_THIS
 
@@ -148,6 +178,7 @@ MusxInstanceList<others::StaffUsed> Document::getStudioViewStaves(Cmper partId)
 
 std::optional<KnownShapeDefType> Document::getCachedShapeRecognition(Cmper shapeCmper) const
 {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     auto it = m_shapeRecognitionCache.find(shapeCmper);
     if (it != m_shapeRecognitionCache.end()) {
         return it->second;
@@ -157,11 +188,13 @@ std::optional<KnownShapeDefType> Document::getCachedShapeRecognition(Cmper shape
 
 void Document::setCachedShapeRecognition(Cmper shapeCmper, KnownShapeDefType type) const
 {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     m_shapeRecognitionCache[shapeCmper] = type;
 }
 
 std::optional<bool> Document::getCachedFontIsSMuFL(Cmper fontId) const
 {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     auto it = m_isSmuflFontCache.find(fontId);
     if (it != m_isSmuflFontCache.end()) {
         return it->second;
@@ -171,9 +204,38 @@ std::optional<bool> Document::getCachedFontIsSMuFL(Cmper fontId) const
 
 void Document::setCachedFontIsSMuFL(Cmper fontId, bool isSmufl) const
 {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     m_isSmuflFontCache[fontId] = isSmufl;
 }
 
+const LyricIndex& Document::getLyricIndex(Cmper partId) const
+{
+    return findOrBuild(m_cacheMutex, m_lyricIndexes, partId, [&]() {
+        return std::make_shared<const LyricIndex>(m_self.lock(), partId);
+    });
+}
+
+const GlobalTimeline& Document::getGlobalTimeline(Cmper partId) const
+{
+    return findOrBuild(m_cacheMutex, m_globalTimelines, partId, [&]() {
+        return std::make_shared<const GlobalTimeline>(m_self.lock(), partId);
+    });
+}
+
+const TieGraph& Document::getTieGraph(Cmper partId) const
+{
+    return findOrBuild(m_cacheMutex, m_tieGraphs, partId, [&]() {
+        return std::make_shared<const TieGraph>(m_self.lock(), partId);
+    });
+}
+
+const SmartShapeIndex& Document::getSmartShapeIndex(Cmper partId) const
+{
+    return findOrBuild(m_cacheMutex, m_smartShapeIndexes, partId, [&]() {
+        return std::make_shared<const SmartShapeIndex>(m_self.lock(), partId);
+    });
+}
+
 MusxInstance<others::Page> Document::calcPageFromMeasure(Cmper partId, MeasCmper measureId) const
 {
     const auto part = getOthers()->get<others::PartDefinition>(SCORE_PARTID, partId);
@@ -288,8 +350,8 @@ InstrumentMap Document::createInstrumentMap(Cmper forPartId) const
                     auto& [top, instInfo] = *instIt;
                     if (created || instInfo.staffGroupId == 0 || group->getCmper2() == instInfo.staffGroupId) {
                         if (instInfo.staffGroupId == 0) {
-                            util::Logger::log(util::Logger::LogLevel::Verbose, "Treating piano brace " + std::to_string(group->getCmper2())
-                                + " [" + group->getFullName() + "] on staff " + std::to_string(group->startInst) + " as a multistaff instrument.");
+                            util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "Treating piano brace " + std::to_string(group->getCmper2())
+                                + " [" + group->getFullName() + "] on staff " + std::to_string(group->startInst) + " as a multistaff instrument."; });
                         }
                         instInfo.staffGroupId = group->getCmper2();
                         for (const auto& [cmper, index] : candidateStaves) {
@@ -328,6 +390,10 @@ InstrumentMap Document::createInstrumentMap(Cmper forPartId) const
             }
         }
     }
+    result.calcStaffIndex();
+    for (auto& [instId, info] : result) {
+        info.m_changeTimeline = info.calcChangeTimeline();
+    }
     return result;
 }
 
@@ -348,13 +414,142 @@ std::optional<InstrumentInfo> Document::getInstrumentForStaff(Cmper partId, Staf
         }
         return std::nullopt;
     }
-    const auto partInstrumentMap = createInstrumentMap(partId);
+    const auto& partInstrumentMap = findOrBuild(m_cacheMutex, m_partInstruments, partId, [&]() {
+        return std::make_shared<const InstrumentMap>(createInstrumentMap(partId));
+    });
     if (const auto result = partInstrumentMap.getInstrumentForStaff(staffId)) {
         return *result;
     }
     return std::nullopt;
 }
 
+bool Document::isStaffInPart(StaffCmper staffId, Cmper partId) const
+{
+    if (m_membershipParts.empty()) { // the factory has not built the table yet
+        const auto scrollView = getScrollViewStaves(partId);
+        return std::any_of(scrollView.begin(), scrollView.end(), [&](const auto& staffItem) { return staffItem->staffId == staffId; });
+    }
+    const auto partIt = m_membershipPartIndex.find(partId);
+    if (partIt == m_membershipPartIndex.end()) {
+        return false;
+    }
+    const auto staffIt = m_partMembership.find(staffId);
+    if (staffIt == m_partMembership.end()) {
+        return false;
+    }
+    return staffIt->second[partIt->second];
+}
+
+std::vector<MusxInstance<others::PartDefinition>> Document::getPartsContainingStaff(StaffCmper staffId, bool includeScore) const
+{
+    std::vector<MusxInstance<others::PartDefinition>> result;
+    if (m_membershipParts.empty()) { // the factory has not built the table yet
+        for (const auto& part : getOthers()->getArray<others::PartDefinition>(SCORE_PARTID)) {
+            if ((includeScore || part->getCmper() != SCORE_PARTID) && isStaffInPart(staffId, part->getCmper())) {
+                result.push_back(part);
+            }
+        }
+        return result;
+    }
+    const auto staffIt = m_partMembership.find(staffId);
+    if (staffIt == m_partMembership.end()) {
+        return result;
+    }
+    const auto& bits = staffIt->second;
+    for (size_t partIndex = 0; partIndex < bits.size(); partIndex++) {
+        const auto& part = m_membershipParts[partIndex];
+        if (bits[partIndex] && (includeScore || part->getCmper() != SCORE_PARTID)) {
+            result.push_back(part);
+        }
+    }
+    return result;
+}
+
+void Document::createPartMembershipTable()
+{
+    m_partMembership.clear();
+    m_membershipPartIndex.clear();
+    const auto parts = getOthers()->getArray<others::PartDefinition>(SCORE_PARTID);
+    m_membershipParts.assign(parts.begin(), parts.end());
+    for (size_t partIndex = 0; partIndex < m_membershipParts.size(); partIndex++) {
+        const Cmper partId = m_membershipParts[partIndex]->getCmper();
+        m_membershipPartIndex.emplace(partId, partIndex);
+        for (const auto& staffItem : getScrollViewStaves(partId)) {
+            auto& bits = m_partMembership[staffItem->staffId];
+            bits.resize(m_membershipParts.size());
+            bits[partIndex] = true;
+        }
+    }
+}
+
+void Document::createSortedTupletMap()
+{
+    m_sortedTuplets.clear();
+    std::vector<Cmper> partIds{ SCORE_PARTID };
+    for (const auto& part : getOthers()->getArray<others::PartDefinition>(SCORE_PARTID)) {
+        if (part->getCmper() != SCORE_PARTID) {
+            partIds.push_back(part->getCmper());
+        }
+    }
+    for (const Cmper partId : partIds) {
+        auto& tupletsByEntry = m_sortedTuplets[partId];
+        for (const auto& tuplet : getDetails()->getArray<details::TupletDef>(partId)) {
+            tupletsByEntry[tuplet->getEntryNumber()].push_back(tuplet);
+        }
+        for (auto& [entryNumber, tuplets] : tupletsByEntry) {
+            (void)entryNumber;
+            sortTupletsByReferenceDuration(tuplets);
+        }
+    }
+}
+
+void Document::updateSortedTuplets(EntryNumber entryNumber)
+{
+    for (auto& [partId, tupletsByEntry] : m_sortedTuplets) {
+        const auto tuplets = getDetails()->getArray<details::TupletDef>(partId, entryNumber);
+        if (tuplets.empty()) {
+            tupletsByEntry.erase(entryNumber);
+            continue;
+        }
+        auto& sorted = tupletsByEntry[entryNumber];
+        sorted.assign(tuplets.begin(), tuplets.end());
+        sortTupletsByReferenceDuration(sorted);
+    }
+}
+
+void Document::discardPartCaches(Cmper partId, EditScope::Kind kind)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    switch (kind) {
+    case EditScope::Kind::Entries:
+        m_lyricIndexes.erase(partId);
+        m_smartShapeIndexes.erase(partId);
+        m_tieGraphs.erase(partId);
+        break;
+    case EditScope::Kind::Measures:
+        m_globalTimelines.erase(partId);
+        m_smartShapeIndexes.erase(partId); // beat-attached endpoints are resolved from measure timing
+        m_tieGraphs.erase(partId); // jump ties follow repeats and endings
+        break;
+    case EditScope::Kind::Staves:
+        m_partInstruments.erase(partId);
+        break;
+    default:
+        break;
+    }
+}
+
+const std::vector<MusxInstance<details::TupletDef>>* Document::getSortedTuplets(Cmper partId, EntryNumber entryNumber) const
+{
+    static const std::vector<MusxInstance<details::TupletDef>> noTuplets;
+    const auto partIt = m_sortedTuplets.find(partId);
+    if (partIt == m_sortedTuplets.end()) {
+        return nullptr;
+    }
+    const auto it = partIt->second.find(entryNumber);
+    return it != partIt->second.end() ? &it->second : &noTuplets;
+}
+
 void Document::createRehearsalMarkMap()
 {
     m_rehearsalMarks.clear();
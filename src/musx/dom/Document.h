@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -55,9 +56,18 @@ using namespace header;
 
 namespace others {
 class MeasureExprAssign;
+class PartDefinition;
+}
+
+namespace details {
+class TupletDef;
 }
 
 enum class KnownShapeDefType;
+class LyricIndex;
+class GlobalTimeline;
+class TieGraph;
+class SmartShapeIndex;
 using EmbeddedGraphicBlob = std::vector<uint8_t>; ///< Raw bytes for one embedded graphic payload from a musx archive.
 
 /// @brief Embedded graphic payload from a musx archive entry.
@@ -98,6 +108,28 @@ struct RehearsalMarkInfo
 /// @brief Maps each occurrence of a rehearsal mark to its sequence number for that measure.
 using RehearsalMarkMap = std::map<RehearsalMarkKey, RehearsalMarkInfo>;
 
+/// @brief Describes a programmatic edit to a finalized document, so that only the derived data it affects is recomputed.
+///
+/// See @ref Document::markDirty and @ref factory::DocumentFactory::refresh.
+struct EditScope
+{
+    /// @brief The kind of data that was edited.
+    enum class Kind
+    {
+        Entries,        ///< Entries, notes, frames (@ref details::GFrameHold), entry details such as tuplets, lyrics, or smart shapes.
+        Measures,       ///< Measures, time signatures, repeats, or anything else that affects timelines, beat-attached smart shapes, or playback.
+        Staves,         ///< Staves, staff styles, staff groups, or multistaff instruments.
+        Layout,         ///< Pages or systems.
+        Expressions     ///< Expression definitions or assignments, including rehearsal marks.
+    };
+
+    Kind kind{};                            ///< What was edited.
+    std::optional<StaffCmper> staffId;      ///< The edited staff, or std::nullopt for all staves.
+    std::optional<MeasCmper> startMeasure;  ///< The first edited measure, or std::nullopt for the start of the document.
+    std::optional<MeasCmper> endMeasure;    ///< The last edited measure, or std::nullopt for the end of the document.
+    std::optional<Cmper> partId;            ///< The edited score or linked part, or std::nullopt for data shared by all parts.
+};
+
 /**
  * @brief Represents a document object that encapsulates the entire EnigmaXML structure.
  */
@@ -192,6 +224,26 @@ public:
     /// @brief Stores a SMuFL font recognition result in the cache.
     void setCachedFontIsSMuFL(Cmper fontId, bool isSmufl) const;
 
+    /// @brief Returns the lyric assignment index for a score or linked part, building it on first use.
+    /// @param partId The linked part to index. (Use #SCORE_PARTID for the score.)
+    [[nodiscard]]
+    const LyricIndex& getLyricIndex(Cmper partId) const;
+
+    /// @brief Returns the precomputed measure timing for a score or linked part, building it on first use.
+    /// @param partId The linked part whose timeline to return. (Use #SCORE_PARTID for the score.)
+    [[nodiscard]]
+    const GlobalTimeline& getGlobalTimeline(Cmper partId) const;
+
+    /// @brief Returns the tie links between notes for a score or linked part, building them on first use.
+    /// @param partId The linked part whose ties to return. (Use #SCORE_PARTID for the score.)
+    [[nodiscard]]
+    const TieGraph& getTieGraph(Cmper partId) const;
+
+    /// @brief Returns the smart shape index for a score or linked part, building it on first use.
+    /// @param partId The linked part to index. (Use #SCORE_PARTID for the score.)
+    [[nodiscard]]
+    const SmartShapeIndex& getSmartShapeIndex(Cmper partId) const;
+
     /// @brief Searches pages to find the page that contains the measure.
     /// @return The page, or nullptr if the part's page layout is unavailable or the measure is not found.
     /// @param partId the linked part to search
@@ -251,6 +303,22 @@ public:
     [[nodiscard]]
     std::optional<InstrumentInfo> getInstrumentForStaff(Cmper partId, StaffCmper staffId) const;
 
+    /// @brief Returns true if the staff appears in Scroll View of the specified score or linked part.
+    ///
+    /// This is a lookup in the staff-by-part membership table computed by the factory.
+    /// @param staffId The staff to check.
+    /// @param partId The linked part to check. (Use #SCORE_PARTID for the score.)
+    [[nodiscard]]
+    bool isStaffInPart(StaffCmper staffId, Cmper partId) const;
+
+    /// @brief Returns the score and linked parts whose Scroll View contains the staff, in pool order.
+    ///
+    /// This reads the same membership table as #isStaffInPart.
+    /// @param staffId The staff to check.
+    /// @param includeScore If true, include the score in the list.
+    [[nodiscard]]
+    std::vector<MusxInstance<others::PartDefinition>> getPartsContainingStaff(StaffCmper staffId, bool includeScore) const;
+
     /// @brief Returns the rehearsal mark info for a rehearsal mark text expression assignment.
     /// @return The rehearsal mark info or std::nullopt if none.
     [[nodiscard]]
@@ -292,12 +360,33 @@ public:
     [[nodiscard]]
     std::vector<MeasCmper> calcJumpFromMeasures(Cmper partId, MeasCmper currentMeasure) const;
 
+    /// @brief Returns the tuplets that start on an entry, sorted by descending reference duration.
+    ///
+    /// The lists are computed by the factory for the score and every linked part, so that creating an entry frame
+    /// does not need to query and sort the details pool for each tuplet.
+    /// @param partId The linked part id. (Use #SCORE_PARTID for the score.)
+    /// @param entryNumber The entry on which the tuplets start.
+    /// @return The sorted tuplets, which is empty if none start on the entry, or nullptr if no lists were computed for @p partId.
+    [[nodiscard]]
+    const std::vector<MusxInstance<details::TupletDef>>* getSortedTuplets(Cmper partId, EntryNumber entryNumber) const;
+
     /// @brief Iterate all entries in the document by staff and then measure. This function wraps MusxInstanceList<others::StaffUsed>::iterateEntries.
     /// @param partId The linked part id to iterate. (Use #SCORE_PARTID to iterate the score.)
     /// @param iterator The callback function.
     /// @return True if iteration completed. False if the @p iterator returned false and exited early.
     bool iterateEntries(Cmper partId, std::function<bool(const EntryInfoPtr&)> iterator) const;
 
+    /// @brief Records that a programmatic edit invalidated derived data computed by the factory.
+    ///
+    /// Edits are made by modifying pool instances directly. Mark each edit here and then call
+    /// @ref factory::DocumentFactory::refresh, which recomputes only the derived data within the marked scopes.
+    /// @param scope What was edited.
+    void markDirty(const EditScope& scope) { m_dirtyScopes.push_back(scope); }
+
+    /// @brief Returns true if edits have been marked with #markDirty but not yet refreshed.
+    [[nodiscard]]
+    bool hasDirtyScopes() const { return !m_dirtyScopes.empty(); }
+
 private:
     /// @brief Constructs a `Document`
     explicit Document() = default;
@@ -320,13 +409,35 @@ private:
     RehearsalMarkMap m_rehearsalMarks; ///< Map of rehearsal marks in the document.
     void createRehearsalMarkMap();
 
+    std::vector<MusxInstance<others::PartDefinition>> m_membershipParts; ///< Parts in pool order, indexing the bits in #m_partMembership.
+    std::unordered_map<Cmper, size_t> m_membershipPartIndex; ///< Maps each part id to its bit in #m_partMembership.
+    std::unordered_map<StaffCmper, std::vector<bool>> m_partMembership; ///< For each staff, the parts whose Scroll View contains it.
+                                ///< This is computed by the factory.
+    void createPartMembershipTable();
+
+    /// @brief Tuplets keyed by start entry and sorted by descending reference duration.
+    using SortedTupletMap = std::unordered_map<EntryNumber, std::vector<MusxInstance<details::TupletDef>>>;
+    std::unordered_map<Cmper, SortedTupletMap> m_sortedTuplets; ///< Sorted tuplets for each part. This is computed by the factory.
+    void createSortedTupletMap();
+    void updateSortedTuplets(EntryNumber entryNumber);
+
+    std::vector<EditScope> m_dirtyScopes;   ///< Edits marked by #markDirty that are waiting for a refresh.
+    void discardPartCaches(Cmper partId, EditScope::Kind kind);
+
     PartVoicingPolicy m_partVoicingPolicy{};    ///< The part voicing policy in effect for this document.
     std::optional<double> m_scoreDurationSeconds; ///< Optional score duration in seconds from NotationMetadata.xml.
     EmbeddedGraphicsMap m_embeddedGraphics;     ///< Embedded graphics passed in by the caller (from musx container files).
     std::optional<std::filesystem::path> m_sourcePath; ///< Path to the musx (or EnigmaXML) file used to create this document.
 
+    /// Guards the lazily built caches below so that a finalized document can be read from several threads at once.
+    mutable std::mutex m_cacheMutex;
     mutable std::unordered_map<Cmper, KnownShapeDefType> m_shapeRecognitionCache; ///< Cache of ShapeDef recognitions.
     mutable std::unordered_map<Cmper, bool> m_isSmuflFontCache; ///< Cache of SMuFL font recognitions.
+    mutable std::unordered_map<Cmper, std::shared_ptr<const LyricIndex>> m_lyricIndexes; ///< Lazily built lyric indexes by part.
+    mutable std::unordered_map<Cmper, std::shared_ptr<const GlobalTimeline>> m_globalTimelines; ///< Lazily built global timelines by part.
+    mutable std::unordered_map<Cmper, std::shared_ptr<const TieGraph>> m_tieGraphs; ///< Lazily built tie graphs by part.
+    mutable std::unordered_map<Cmper, std::shared_ptr<const InstrumentMap>> m_partInstruments; ///< Lazily built instrument maps for linked parts.
+    mutable std::unordered_map<Cmper, std::shared_ptr<const SmartShapeIndex>> m_smartShapeIndexes; ///< Lazily built smart shape indexes by part.
 
     // Grant the factory class access to the private constructor
     friend class musx::factory::DocumentFactory;
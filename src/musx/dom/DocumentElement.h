@@ -64,6 +64,24 @@ public:
         return document;
     }
 
+    /**
+     * @brief Gets the Document without changing its reference count.
+     *
+     * Prefer this over #getDocument for queries inside the DOM. Every query starts from a @ref DocumentPtr that the
+     * caller holds, and the Document owns every pool, so the reference remains valid for the duration of the query.
+     * Use #getDocument when the document must be retained or passed on as a @ref DocumentPtr.
+     *
+     * @return A reference to the Document instance.
+     * @throws std::logic_error if the document no longer exists.
+     */
+    Document& getDocumentRef() const
+    {
+        MUSX_ASSERT_IF(!m_documentRef || m_document.expired()) {
+            throw std::logic_error("Document pointer is no longer valid.");
+        }
+        return *m_documentRef;
+    }
+
     /**
      * @brief Gets the part id associated with this instance.
      */
@@ -77,7 +95,7 @@ protected:
      * @param partId The part id associated with this instance.
      */
     DocumentElement(const DocumentWeakPtr& document, Cmper partId)
-        : m_document(document), m_partId(partId) {}
+        : m_document(document), m_documentRef(document.lock().get()), m_partId(partId) {}
 
     DocumentElement(const DocumentElement&) = default;        ///< explicit default copy constructor
     DocumentElement(DocumentElement&&) noexcept = default;    ///< explicit default move constructor
@@ -90,6 +108,7 @@ protected:
 
 private:
     const DocumentWeakPtr m_document{};
+    Document* const m_documentRef{};    ///< Non-owning pointer that is valid as long as #m_document has not expired.
     const Cmper m_partId{};
 };
 
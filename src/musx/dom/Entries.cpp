@@ -24,6 +24,7 @@
 #include <exception>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "musx/musx.h"
@@ -151,7 +152,7 @@ static bool forVoice2(int voice)
 MusxInstance<Entry> Entry::getNext() const
 {
     if (!m_next) return nullptr;
-    auto retval = getDocument()->getEntries()->get(m_next);
+    auto retval = getDocumentRef().getEntries()->getNext(*this);
     if (!retval) {
         MUSX_INTEGRITY_ERROR("Entry " + std::to_string(m_entnum) + " has next entry " + std::to_string(m_next) + " that does not exist.");
     }
@@ -161,7 +162,7 @@ MusxInstance<Entry> Entry::getNext() const
 MusxInstance<Entry> Entry::getPrevious() const
 {
     if (!m_prev) return nullptr;
-    auto retval = getDocument()->getEntries()->get(m_prev);
+    auto retval = getDocumentRef().getEntries()->get(m_prev);
     if (!retval) {
         MUSX_INTEGRITY_ERROR("Entry " + std::to_string(m_entnum) + " has previous entry " + std::to_string(m_prev) + " that does not exist.");
     }
@@ -205,21 +206,243 @@ unsigned calcNumberOfBeamsInEdu(Edu duration)
 
 void Entry::calcLocations(const DocumentPtr& document)
 {
+    const auto& entries = document->getEntries();
+    entries->clearLocations();
     auto gfholds = document->getDetails()->getArray<details::GFrameHold>(SCORE_PARTID);
     for (const auto& gfhold : gfholds) {
-        if (gfhold->mirrorFrame) {
+        entries->locateFrameEntries(*gfhold);
+    }
+    entries->buildArena();
+}
+
+void Entry::calcLocations(const DocumentPtr& document, StaffCmper staffId, MeasCmper startMeas, MeasCmper endMeas)
+{
+    const auto& entries = document->getEntries();
+    entries->buildFrameEntries();
+    for (MeasCmper measureId = startMeas; measureId <= endMeas; measureId++) {
+        if (auto gfhold = document->getDetails()->get<details::GFrameHold>(SCORE_PARTID, staffId, measureId)) {
+            entries->locateFrameEntries(*gfhold);
+        } else {
+            entries->clearFrameEntries(staffId, measureId);
+        }
+    }
+}
+
+// *********************
+// ***** EntryPool *****
+// *********************
+
+void EntryPool::clearLocations()
+{
+    for (auto& [entryNumber, entry] : m_pool) {
+        entry->location.clear();
+    }
+    m_frameEntries.clear();
+    m_frameEntriesBuilt = false;
+}
+
+void EntryPool::locateFrameEntries(const details::GFrameHold& gfhold)
+{
+    const auto staffId = static_cast<StaffCmper>(gfhold.getCmper1());
+    const auto measureId = static_cast<MeasCmper>(gfhold.getCmper2());
+    std::vector<EntryNumber>* frameEntries = nullptr;
+    if (m_frameEntriesBuilt) {
+        clearFrameEntries(staffId, measureId);
+        frameEntries = &m_frameEntries[{ staffId, measureId }];
+    }
+    if (gfhold.mirrorFrame) {
+        return;
+    }
+    std::array<size_t, MAX_LAYERS> nextIndexByLayer{};
+    gfhold.iterateRawEntries([&](const MusxInstance<Entry>& entry, LayerIndex layerIndex) {
+        const auto li = static_cast<size_t>(layerIndex);
+        Entry* mutableEntry = const_cast<Entry*>(entry.get());
+        mutableEntry->location = { staffId, measureId, layerIndex, nextIndexByLayer[li]++ };
+        if (frameEntries) {
+            frameEntries->push_back(entry->getEntryNumber());
+        }
+        return true;
+    });
+}
+
+void EntryPool::clearFrameEntries(StaffCmper staffId, MeasCmper measureId)
+{
+    const auto frameIt = m_frameEntries.find({ staffId, measureId });
+    if (frameIt == m_frameEntries.end()) {
+        return;
+    }
+    for (const EntryNumber entryNumber : frameIt->second) {
+        const auto it = m_pool.find(entryNumber);
+        if (it != m_pool.end() && it->second->location.staffId == staffId && it->second->location.measureId == measureId) {
+            it->second->location.clear();
+        }
+    }
+    m_frameEntries.erase(frameIt);
+}
+
+void EntryPool::buildFrameEntries()
+{
+    if (m_frameEntriesBuilt) {
+        return;
+    }
+    std::vector<const Entry*> located;
+    for (const auto& [entryNumber, entry] : m_pool) {
+        if (entry->location.found()) {
+            located.push_back(entry.get());
+        }
+    }
+    std::sort(located.begin(), located.end(), [](const Entry* a, const Entry* b) {
+        return std::tie(a->location.staffId, a->location.measureId, a->location.layerIndex, a->location.entryIndex)
+            < std::tie(b->location.staffId, b->location.measureId, b->location.layerIndex, b->location.entryIndex);
+    });
+    m_frameEntries.clear();
+    for (const Entry* entry : located) {
+        m_frameEntries[{ entry->location.staffId, entry->location.measureId }].push_back(entry->getEntryNumber());
+    }
+    m_frameEntriesBuilt = true;
+}
+
+const std::vector<EntryNumber>& EntryPool::getFrameEntries(StaffCmper staffId, MeasCmper measureId) const
+{
+    static const std::vector<EntryNumber> noEntries;
+    const auto it = m_frameEntries.find({ staffId, measureId });
+    return it != m_frameEntries.end() ? it->second : noEntries;
+}
+
+void EntryPool::buildArena()
+{
+    m_arena.clear();
+    m_arena.reserve(m_pool.size());
+
+    std::vector<Entry*> located;
+    std::vector<Entry*> unlocated;
+    located.reserve(m_pool.size());
+    for (const auto& [entryNumber, entry] : m_pool) {
+        entry->m_arenaSlot = (std::numeric_limits<size_t>::max)();
+        if (entry->location.found()) {
+            located.push_back(entry.get());
+        } else if (!entry->m_prev || m_pool.find(entry->m_prev) == m_pool.end()) {
+            unlocated.push_back(entry.get()); // head of an entry list that is not in any frame
+        }
+    }
+    std::sort(located.begin(), located.end(), [](const Entry* a, const Entry* b) {
+        const auto& x = a->location;
+        const auto& y = b->location;
+        return std::tie(x.staffId, x.measureId, x.layerIndex, x.entryIndex, a->m_entnum)
+            < std::tie(y.staffId, y.measureId, y.layerIndex, y.entryIndex, b->m_entnum);
+    });
+    for (Entry* entry : located) {
+        entry->m_arenaSlot = m_arena.size();
+        m_arena.push_back(m_pool.at(entry->m_entnum));
+    }
+    // Remaining entries are not in any frame. Keep each list chain together in entry list order.
+    std::sort(unlocated.begin(), unlocated.end(), [](const Entry* a, const Entry* b) { return a->m_entnum < b->m_entnum; });
+    for (Entry* head : unlocated) {
+        for (Entry* entry = head; entry && !entry->location.found(); ) {
+            if (entry->m_arenaSlot < m_arena.size()) {
+                break; // cycle in a malformed entry list
+            }
+            entry->m_arenaSlot = m_arena.size();
+            m_arena.push_back(m_pool.at(entry->m_entnum));
+            const auto next = entry->m_next ? m_pool.find(entry->m_next) : m_pool.end();
+            entry = next != m_pool.end() ? next->second.get() : nullptr;
+        }
+    }
+}
+
+std::optional<size_t> EntryPool::findArenaSlot(const Entry& entry) const
+{
+    if (entry.m_arenaSlot < m_arena.size() && m_arena[entry.m_arenaSlot].get() == &entry) {
+        return entry.m_arenaSlot;
+    }
+    return std::nullopt;
+}
+
+MusxInstance<Entry> EntryPool::getNext(const Entry& entry) const
+{
+    if (!entry.m_next) {
+        return nullptr;
+    }
+    if (const auto slot = findArenaSlot(entry); slot && *slot + 1 < m_arena.size()) {
+        const auto& candidate = m_arena[*slot + 1];
+        if (candidate->m_entnum == entry.m_next) {
+            return candidate;
+        }
+    }
+    return get(entry.m_next);
+}
+
+bool EntryPool::iterateEntries(const MusxInstance<Entry>& firstEntry, EntryNumber lastEntry,
+    const std::function<bool(const MusxInstance<Entry>&)>& iterator) const
+{
+    MusxInstance<Entry> entry = firstEntry;
+    while (entry) {
+        if (const auto firstSlot = findArenaSlot(*entry)) {
+            MusxInstance<Entry> next;
+            for (size_t slot = *firstSlot; slot < m_arena.size(); slot++) {
+                const auto& arenaEntry = m_arena[slot];
+                if (!iterator(arenaEntry)) {
+                    return false;
+                }
+                if (arenaEntry->m_entnum == lastEntry || !arenaEntry->m_next) {
+                    return true;
+                }
+                if (slot + 1 >= m_arena.size() || m_arena[slot + 1]->m_entnum != arenaEntry->m_next) {
+                    // the arena diverges from the entry list here, so continue along the list
+                    next = arenaEntry->getNext();
+                    break;
+                }
+            }
+            entry = std::move(next);
             continue;
         }
-        std::array<size_t, MAX_LAYERS> nextIndexByLayer{};
-        const auto staffId = static_cast<StaffCmper>(gfhold->getCmper1());
-        const auto measureId  = static_cast<MeasCmper>(gfhold->getCmper2());
-        gfhold->iterateRawEntries([&](const MusxInstance<Entry>& entry, LayerIndex layerIndex) {
-            const auto li = static_cast<size_t>(layerIndex);
-            Entry* mutableEntry = const_cast<Entry*>(entry.get());
-            mutableEntry->location = { staffId, measureId, layerIndex, nextIndexByLayer[li]++ };
+        if (!iterator(entry)) {
+            return false;
+        }
+        if (entry->getEntryNumber() == lastEntry) {
             return true;
-        });
+        }
+        entry = entry->getNext();
+    }
+    return true;
+}
+
+// *****************************
+// ***** EntryInfoResolver *****
+// *****************************
+
+std::shared_ptr<const EntryFrame> EntryInfoResolver::getFrame(StaffCmper staffId, MeasCmper measureId, LayerIndex layerIndex)
+{
+    const auto [it, inserted] = m_frames.try_emplace(FrameKey{ staffId, measureId, layerIndex });
+    if (inserted) {
+        if (auto gfhold = details::GFrameHoldContext(m_document, m_partId, staffId, measureId, m_timeOffset)) {
+            it->second = gfhold.createEntryFrame(layerIndex);
+        }
     }
+    return it->second;
+}
+
+EntryInfoPtr EntryInfoResolver::resolve(EntryNumber entryNumber)
+{
+    if (const auto entry = m_document->getEntries()->get(entryNumber)) {
+        if (entry->location.found()) {
+            const auto& loc = entry->location;
+            if (auto entryFrame = getFrame(loc.staffId, loc.measureId, loc.layerIndex)) {
+                MUSX_ASSERT_IF(loc.entryIndex >= entryFrame->getEntries().size()) {
+                    throw std::logic_error("Entry " + std::to_string(entryNumber) + " has entry index " + std::to_string(loc.entryIndex) + " that is too large for frame.");
+                }
+                auto result = EntryInfoPtr(entryFrame, loc.entryIndex);
+                MUSX_ASSERT_IF(result->getEntry()->getEntryNumber() != entryNumber) {
+                    throw std::logic_error("Entry " + std::to_string(entryNumber) + " has incorrect location values.");
+                }
+                return result;
+            }
+            MUSX_ASSERT_IF(false) {
+                throw std::logic_error("Entry " + std::to_string(entryNumber) + " has invalid location values.");
+            }
+        }
+    }
+    return {};
 }
 
 // **********************
@@ -228,6 +451,8 @@ void Entry::calcLocations(const DocumentPtr& document)
 
 DocumentPtr EntryFrame::getDocument() const { return m_context->getDocument(); }
 
+Document& EntryFrame::getDocumentRef() const { return m_context->getDocumentRef(); }
+
 StaffCmper EntryFrame::getStaff() const { return m_context->getStaff(); }
 
 MeasCmper EntryFrame::getMeasure() const { return m_context->getMeasure(); }
@@ -235,7 +460,7 @@ MeasCmper EntryFrame::getMeasure() const { return m_context->getMeasure(); }
 MusxInstance<others::LayerAttributes> EntryFrame::getLayerAttributes() const
 {
     if (!m_cachedLayerAttributes) {
-        m_cachedLayerAttributes = getDocument()->getOthers()->get<others::LayerAttributes>(getRequestedPartId(), Cmper(getLayerIndex()));
+        m_cachedLayerAttributes = getDocumentRef().getOthers()->get<others::LayerAttributes>(getRequestedPartId(), Cmper(getLayerIndex()));
     }
     return m_cachedLayerAttributes;
 }
@@ -311,7 +536,7 @@ MusxInstance<others::StaffComposite> EntryFrame::createCurrentStaff(Edu eduPosit
 
 MusxInstance<others::Measure> EntryFrame::getMeasureInstance() const
 {
-    return getDocument()->getOthers()->get<others::Measure>(getRequestedPartId(), getMeasure());
+    return getDocumentRef().getOthers()->get<others::Measure>(getRequestedPartId(), getMeasure());
 }
 
 bool EntryFrame::calcAreAllEntriesHiddenInFrame() const
@@ -362,7 +587,7 @@ bool EntryFrame::TupletInfo::calcIsTremolo() const
     }
 
     // entries must have the same duration and actual duration.
-    auto frame = getParent();
+    const auto frame = getParent().shared_from_this();
     MUSX_ASSERT_IF(startIndex >= frame->getEntries().size()) {
         throw std::logic_error("TupletInfo instance contains invalid start index.");
     }
@@ -417,8 +642,11 @@ bool EntryFrame::TupletInfo::calcIsTremolo() const
     return !EntryInfoPtr(frame, startIndex).calcIsFeatheredBeamStart(outLeftYScratch, outRightYScratch);
 }
 
-bool EntryFrame::TupletInfo::calcCreatesSingleton(bool left) const
+bool EntryFrame::TupletInfo::calcCreatesSingleton(const std::shared_ptr<const EntryFrame>& frame, bool left) const
 {
+    MUSX_ASSERT_IF(frame.get() != m_parent) {
+        throw std::logic_error("TupletInfo was passed a frame that does not own it.");
+    }
     MUSX_ASSERT_IF(!tuplet) {
         throw std::logic_error("TupletInfo contains no tuplet.");
     }
@@ -437,7 +665,6 @@ bool EntryFrame::TupletInfo::calcCreatesSingleton(bool left) const
         return false;
     }
     // entries must have the same duration and actual duration.
-    auto frame = getParent();
     MUSX_ASSERT_IF(startIndex >= frame->getEntries().size()) {
         throw std::logic_error("TupletInfo instance contains invalid start index.");
     }
@@ -476,7 +703,7 @@ bool EntryFrame::TupletInfo::calcCreatesSingleton(bool left) const
         if (!noteInfo) {
             return false;
         }
-        auto noteheadMods = frame->getDocument()->getDetails()->getForNote<details::NoteAlterations>(noteInfo, frame->getRequestedPartId());
+        auto noteheadMods = frame->getDocumentRef().getDetails()->getForNote<details::NoteAlterations>(noteInfo, frame->getRequestedPartId());
         if (!noteheadMods) {
             return false;
         }
@@ -499,21 +726,21 @@ bool EntryFrame::TupletInfo::calcCreatesTimeStretch() const
             return false;
         }
     }
-    auto frame = getParent();
+    const auto& frame = getParent();
     // staff must be independent timesig
-    const auto staff = frame->createCurrentStaff(0);
+    const auto staff = frame.createCurrentStaff(0);
     if (staff && !staff->floatTime) {
         return false;
     }
     // durations must match
-    const auto measure = frame->getMeasureInstance();
+    const auto measure = frame.getMeasureInstance();
     if (staff && measure) {
         if (tuplet->calcReferenceDuration() == measure->calcDuration()) {
             auto dispTime = measure->createDisplayTimeSignature(staff->getCmper());
             return tuplet->calcDisplayDuration() == dispTime->calcTotalDuration();
         }
     } else {
-        MUSX_INTEGRITY_ERROR("Unable to get data record for Staff " + std::to_string(frame->getStaff()) + " or Measure " + std::to_string(frame->getMeasure()));
+        MUSX_INTEGRITY_ERROR("Unable to get data record for Staff " + std::to_string(frame.getStaff()) + " or Measure " + std::to_string(frame.getMeasure()));
     }
     return false;
 }
@@ -524,27 +751,7 @@ bool EntryFrame::TupletInfo::calcCreatesTimeStretch() const
 
 EntryInfoPtr EntryInfoPtr::fromEntryNumber(const DocumentPtr& document, Cmper partId, EntryNumber entryNumber, util::Fraction timeOffset)
 {
-    if (const auto entry = document->getEntries()->get(entryNumber)) {
-        if (entry->location.found()) {
-            const auto& loc = entry->location;
-            if (auto gfhold = details::GFrameHoldContext(document, partId, loc.staffId, loc.measureId, timeOffset)) {
-                if (auto entryFrame = gfhold.createEntryFrame(loc.layerIndex)) {
-                    MUSX_ASSERT_IF(loc.entryIndex >= entryFrame->getEntries().size()) {
-                        throw std::logic_error("Entry " + std::to_string(entryNumber) + " has entry index " + std::to_string(loc.entryIndex) + " that is too large for frame.");
-                    }
-                    auto result = EntryInfoPtr(entryFrame, loc.entryIndex);
-                    MUSX_ASSERT_IF(result->getEntry()->getEntryNumber() != entryNumber) {
-                        throw std::logic_error("Entry " + std::to_string(entryNumber) + " has incorrect location values.");
-                    }
-                    return result;
-                }
-            }
-            MUSX_ASSERT_IF(false) {
-                throw std::logic_error("Entry " + std::to_string(entryNumber) + " has invalid location values.");
-            }
-        }
-    }
-    return {};
+    return EntryInfoResolver(document, partId, timeOffset).resolve(entryNumber);
 }
 
 const std::shared_ptr<const EntryInfo> EntryInfoPtr::operator->() const
@@ -729,7 +936,7 @@ MusxInstance<details::EntryPartFieldDetail> EntryInfoPtr::getPartFieldData() con
     const auto frame = getFrame();
     if (frame->getRequestedPartId() != SCORE_PARTID) {
         const auto entry = (*this)->getEntry();
-        if (const auto partData = frame->getDocument()->getDetails()->get<details::EntryPartFieldDetail>(frame->getRequestedPartId(), entry->getEntryNumber())) {
+        if (const auto partData = frame->getDocumentRef().getDetails()->get<details::EntryPartFieldDetail>(frame->getRequestedPartId(), entry->getEntryNumber())) {
             // EntryPartFieldDetail is an outlier in that it is a partially shared entity that should be ignored if it comes from the score.
             if (partData->getSourcePartId() != SCORE_PARTID) {
                 return partData;
@@ -796,7 +1003,7 @@ std::optional<size_t> EntryInfoPtr::calcNextTupletIndex(std::optional<size_t> cu
         const auto& tuplInf = m_entryFrame->tupletInfo[x];
         if (tuplInf.tuplet->calcRatio() == 0) {
             // The InterpretedIterator handles these automatically, so skip them here.
-            if (tuplInf.calcCreatesSingletonBeamRight() || tuplInf.calcCreatesSingletonBeamLeft()) {
+            if (tuplInf.calcCreatesSingletonBeamRight(m_entryFrame) || tuplInf.calcCreatesSingletonBeamLeft(m_entryFrame)) {
                 continue;
             }
         }
@@ -1033,7 +1240,7 @@ int EntryInfoPtr::calcZeroNotePosition() const
     }
 
     if (calcIfLayerSettingsApply()) {
-        const auto miscOptions = entry->getDocument()->getOptions()->get<options::MiscOptions>();
+        const auto miscOptions = entry->getDocumentRef().getOptions()->get<options::MiscOptions>();
         MUSX_ASSERT_IF(!miscOptions) {
             throw std::logic_error("calcZeroNotePosition() could not find the miscellaneous options");
         }
@@ -1078,7 +1285,7 @@ std::pair<Evpu, Evpu> EntryInfoPtr::calcTopBottomExtent() const
 {
     const auto [topLine, botLine] = calcTopBottomStaffPositions();
 
-    const auto stemOptions = getFrame()->getDocument()->getOptions()->get<options::StemOptions>();
+    const auto stemOptions = getFrame()->getDocumentRef().getOptions()->get<options::StemOptions>();
     MUSX_ASSERT_IF(!stemOptions) {
         throw std::logic_error("Unable to retrieve stem options for calculating entry extent.");
     }
@@ -1178,7 +1385,7 @@ bool EntryInfoPtr::calcUpStemImpl() const
     //we must always look for a beam to calculate direction.
     auto beamStart = findBeamStartOrCurrent();
     // cross-staff direction was not part of the 2001 testing, but this seems the right place for it for now.
-    const auto scrollViewStaves = getFrame()->getDocument()->getScrollViewStaves(getFrame()->getRequestedPartId());
+    const auto scrollViewStaves = getFrame()->getDocumentRef().getScrollViewStaves(getFrame()->getRequestedPartId());
     int foundCrossDirection = 0;
     for (auto next = beamStart; next; next = next.getNextInBeamGroup()) {
         const int currDirection = next.calcCrossStaffDirectionForAll(scrollViewStaves);
@@ -1250,7 +1457,7 @@ bool EntryInfoPtr::calcGraceNoteSlash(const MusxInstance<options::GraceNoteOptio
         if (graceOptions) {
             return graceOptions;
             }
-        return getFrame()->getDocument()->getOptions()->get<options::GraceNoteOptions>();
+        return getFrame()->getDocumentRef().getOptions()->get<options::GraceNoteOptions>();
     }();
     MUSX_ASSERT_IF(!options) {
         util::Logger::log(util::Logger::LogLevel::Warning, "calcGraceNoteSlash: unable to get grace note options.");
@@ -1302,9 +1509,9 @@ bool EntryInfoPtr::calcIsBeamStart(BeamIterationMode beamIterationMode) const
 
 bool EntryInfoPtr::calcCreatesSingletonBeamLeft() const
 {
-    auto entryFrame = getFrame();
+    const auto& entryFrame = m_entryFrame;
     for (const auto& tuplInfo : entryFrame->tupletInfo) {
-        if (tuplInfo.startIndex == getIndexInFrame() && tuplInfo.calcCreatesSingletonBeamLeft()) {
+        if (tuplInfo.startIndex == getIndexInFrame() && tuplInfo.calcCreatesSingletonBeamLeft(entryFrame)) {
             return true;
         }
     }
@@ -1313,9 +1520,9 @@ bool EntryInfoPtr::calcCreatesSingletonBeamLeft() const
 
 bool EntryInfoPtr::calcCreatesSingletonBeamRight() const
 {
-    auto entryFrame = getFrame();
+    const auto& entryFrame = m_entryFrame;
     for (const auto& tuplInfo : entryFrame->tupletInfo) {
-        if (tuplInfo.startIndex == getIndexInFrame() && tuplInfo.calcCreatesSingletonBeamRight()) {
+        if (tuplInfo.startIndex == getIndexInFrame() && tuplInfo.calcCreatesSingletonBeamRight(entryFrame)) {
             return true;
         }
     }
@@ -1703,7 +1910,7 @@ unsigned EntryInfoPtr::calcNumberOfBeams() const
 unsigned EntryInfoPtr::calcVisibleBeams() const
 {
     if (calcDisplaysAsRest()) {
-        if (auto opts = (*this)->getEntry()->getDocument()->getOptions()->get<options::BeamOptions>()) {
+        if (auto opts = (*this)->getEntry()->getDocumentRef().getOptions()->get<options::BeamOptions>()) {
             if (!opts->extendSecBeamsOverRests) {
                 return 1;
             }
@@ -1716,7 +1923,7 @@ template<EntryInfoPtr(EntryInfoPtr::* Iterator)() const>
 std::optional<unsigned> EntryInfoPtr::iterateFindRestsInSecondaryBeam(const EntryInfoPtr nextOrPrevInBeam) const
 {
     auto entry = (*this)->getEntry();
-    if (auto opts = entry->getDocument()->getOptions()->get<options::BeamOptions>()) {
+    if (auto opts = entry->getDocumentRef().getOptions()->get<options::BeamOptions>()) {
         auto cutsBeam = [&](const EntryInfoPtr& entryInfo) -> bool {
             if (entryInfo->getEntry()->isHidden) {
                 return true;
@@ -1772,7 +1979,7 @@ unsigned EntryInfoPtr::calcLowestBeamStart(bool considerBeamOverBarlines) const
     auto entry = (*this)->getEntry();
     unsigned secondaryBreak = 0;
     if (entry->secBeam) {
-        if (auto beamBreaks = m_entryFrame->getDocument()->getDetails()->get<details::SecondaryBeamBreak>(m_entryFrame->getRequestedPartId(), entry->getEntryNumber())) {
+        if (auto beamBreaks = m_entryFrame->getDocumentRef().getDetails()->get<details::SecondaryBeamBreak>(m_entryFrame->getRequestedPartId(), entry->getEntryNumber())) {
             secondaryBreak = beamBreaks->calcLowestBreak();
             if (secondaryBreak < 2) {
                 secondaryBreak = 0;
@@ -1846,7 +2053,7 @@ bool EntryInfoPtr::calcBeamStubIsLeft() const
 {
     auto entry = (*this)->getEntry();
     if (entry->stemDetail) {
-        if (auto manual = m_entryFrame->getDocument()->getDetails()->get<details::BeamStubDirection>(m_entryFrame->getRequestedPartId(), entry->getEntryNumber())) {
+        if (auto manual = m_entryFrame->getDocumentRef().getDetails()->get<details::BeamStubDirection>(m_entryFrame->getRequestedPartId(), entry->getEntryNumber())) {
             return manual->isLeft();
         }
     }
@@ -1867,7 +2074,7 @@ bool EntryInfoPtr::calcBeamStubIsLeft() const
                 if (!neighbor->getEntry()->isNote) {
                     // If we are not extending secondary beams over rests, then rests always cut to the 8th beam.
                     // That means for this purpose the neighbor rest has only a single beam and therefore cannot be compared to the current.
-                    if (auto beamOpts = (*this)->getEntry()->getDocument()->getOptions()->get<options::BeamOptions>()) {
+                    if (auto beamOpts = (*this)->getEntry()->getDocumentRef().getOptions()->get<options::BeamOptions>()) {
                         if (!beamOpts->extendSecBeamsOverRests) {
                             return false;
                         }
@@ -1985,7 +2192,7 @@ EntryInfoPtr EntryInfoPtr::iterateBeamGroup(BeamIterationMode beamIterationMode)
         auto thisRawEntry = (*this)->getEntry();
         auto resultEntry = result->getEntry();
         if (calcDisplaysAsRest() || result.calcDisplaysAsRest()) {
-            auto beamOpts = getFrame()->getDocument()->getOptions()->get<options::BeamOptions>();
+            auto beamOpts = getFrame()->getDocumentRef().getOptions()->get<options::BeamOptions>();
             MUSX_ASSERT_IF(!beamOpts) {
                 throw std::logic_error("Document has no BeamOptions.");
             }
@@ -2157,7 +2364,7 @@ bool EntryInfoPtr::calcIfLayerSettingsApply() const
         if (nextLayerIndex == layerIndex || context->frames[nextLayerIndex] == 0) {
             continue;
         }
-        const auto nextLayerAtts = frame->getDocument()->getOthers()->get<others::LayerAttributes>(frame->getRequestedPartId(), static_cast<Cmper>(nextLayerIndex));
+        const auto nextLayerAtts = frame->getDocumentRef().getOthers()->get<others::LayerAttributes>(frame->getRequestedPartId(), static_cast<Cmper>(nextLayerIndex));
         MUSX_ASSERT_IF(!nextLayerAtts) {
             throw integrity_error("Layer attributes for layer " + std::to_string(nextLayerIndex) + " do not exist.");
         }
@@ -2186,7 +2393,7 @@ int EntryInfoPtr::calcCrossStaffDirectionForAll(DeferredReference<MusxInstanceLi
     const auto frame = getFrame();
 
     if (!staffList) {
-        staffList.emplace(frame->getDocument()->getScrollViewStaves(frame->getRequestedPartId()));
+        staffList.emplace(frame->getDocumentRef().getScrollViewStaves(frame->getRequestedPartId()));
     }
 
     int crossStaffDirectionFound = 0;
@@ -2273,7 +2480,7 @@ bool EntryInfoPtr::calcIsTrillToGraceEntry() const
         throw std::logic_error("Next entry after calcIsAuxiliaryPitchMarker entry is still a grace note.");
     }
     auto graceDistance = static_cast<Evpu>(EVPU_PER_SPACE);
-    if (auto graceOptions = getFrame()->getDocument()->getOptions()->get<options::GraceNoteOptions>()) {
+    if (auto graceOptions = getFrame()->getDocumentRef().getOptions()->get<options::GraceNoteOptions>()) {
         graceDistance = graceOptions->entryOffset;
     }
     graceDistance = calcManuaOffset() - graceDistance;
@@ -2293,9 +2500,9 @@ bool EntryInfoPtr::calcIsGlissToGraceEntry() const
         return false;
     }
     const auto frame = getFrame();
-    const auto smartShapeAssigns = frame->getDocument()->getDetails()->getArray<details::SmartShapeEntryAssign>(frame->getRequestedPartId(), entry->getEntryNumber());
+    const auto smartShapeAssigns = frame->getDocumentRef().getDetails()->getArray<details::SmartShapeEntryAssign>(frame->getRequestedPartId(), entry->getEntryNumber());
     for (const auto& asgn : smartShapeAssigns) {
-        if (const auto shape = frame->getDocument()->getOthers()->get<others::SmartShape>(frame->getRequestedPartId(), asgn->shapeNum)) {
+        if (const auto shape = frame->getDocumentRef().getOthers()->get<others::SmartShape>(frame->getRequestedPartId(), asgn->shapeNum)) {
             switch (shape->shapeType) {
             case others::SmartShape::ShapeType::Glissando:
             case others::SmartShape::ShapeType::TabSlide:
@@ -2318,7 +2525,19 @@ bool EntryInfoPtr::iterateStartingSmartShapes(std::function<bool(const MusxInsta
     const auto entryNumber = entry->getEntryNumber();
     const auto doc = entry->getDocument();
     const auto partId = getFrame()->getRequestedPartId();
+    if (!findExact) {
+        // the index resolves beat-attached endpoints with the same non-exact rules
+        for (const Cmper shapeId : doc->getSmartShapeIndex(partId).getStartingShapes(entryNumber)) {
+            if (const auto shape = doc->getOthers()->get<others::SmartShape>(partId, shapeId)) {
+                if (!callback(shape)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
     const auto measShapeAssigns = doc->getOthers()->getArray<others::SmartShapeMeasureAssign>(partId, measId);
+    EntryInfoResolver resolver(doc, partId);
     for (const auto& assign : measShapeAssigns) {
         if (const auto shape = doc->getOthers()->get<others::SmartShape>(partId, assign->shapeNum)) {
             const auto& startPoint = *shape->startTermSeg->endPoint;
@@ -2331,7 +2550,7 @@ bool EntryInfoPtr::iterateStartingSmartShapes(std::function<bool(const MusxInsta
             if (startPoint.staffId != staffId || startPoint.measId != measId) {
                 continue;
             }
-            const auto startEntry = startPoint.calcAssociatedEntry(findExact);
+            const auto startEntry = startPoint.calcAssociatedEntry(resolver, findExact);
             if (startEntry.isSameEntry(*this)) {
                 if (!callback(shape)) {
                     return false;
@@ -2519,7 +2738,7 @@ std::shared_ptr<const EntryFrame> details::GFrameHoldContext::createEntryFrame(L
     auto [frame, startEdu] = m_hold->findLayerFrame(layerIndex);
     std::shared_ptr<EntryFrame> entryFrame;
     if (frame) {
-        const auto measure = m_hold->getDocument()->getOthers()->get<others::Measure>(getRequestedPartId(), m_hold->getMeasure());
+        const auto measure = m_hold->getDocumentRef().getOthers()->get<others::Measure>(getRequestedPartId(), m_hold->getMeasure());
         if (!measure) {
             throw std::invalid_argument("Measure instance for measure " + std::to_string(m_hold->getMeasure()) + " does not exist.");
         }
@@ -2527,12 +2746,11 @@ std::shared_ptr<const EntryFrame> details::GFrameHoldContext::createEntryFrame(L
         if (!staff) {
             throw std::invalid_argument("Staff instance for staff " + std::to_string(m_hold->getStaff()) + " does not exist.");
         }
-        const util::Fraction timeStretch = staff->floatTime
-                                         ? measure->calcTimeStretch(staff->getCmper())
-                                         : 1;
+        const auto& timeline = m_hold->getDocumentRef().getGlobalTimeline(getRequestedPartId());
+        const util::Fraction timeStretch = timeline.getTimeStretch(m_hold->getMeasure(), m_hold->getStaff());
         entryFrame = std::make_shared<EntryFrame>(*this, layerIndex, timeStretch, staff);
         entryFrame->keySignature = measure->createKeySignature(m_hold->getStaff());
-        entryFrame->measureStaffDuration = measure->calcDuration(m_hold->getStaff());
+        entryFrame->measureStaffDuration = timeline.getStaffDuration(m_hold->getMeasure(), m_hold->getStaff());
         auto entries = frame->getEntries();
         std::vector<TupletState> v1ActiveTuplets; // List of active tuplets for v1
         std::vector<TupletState> v2ActiveTuplets; // List of active tuplets for v2
@@ -2562,14 +2780,21 @@ std::shared_ptr<const EntryFrame> details::GFrameHoldContext::createEntryFrame(L
             if (!entry->graceNote) {
                 graceIndex = 0;
                 if (entry->tupletStart) {
-                    auto tuplets = document->getDetails()->getArray<details::TupletDef>(getRequestedPartId(), entry->getEntryNumber());
-                    std::sort(tuplets.begin(), tuplets.end(), [](const auto& a, const auto& b) {
-                        return a->calcReferenceDuration() > b->calcReferenceDuration(); // Sort descending by reference duration
-                    });
-                    for (const auto& tuplet : tuplets) {
-                        size_t index = entryFrame->tupletInfo.size();
-                        entryFrame->tupletInfo.emplace_back(entryFrame, tuplet, i, actualElapsedDuration, entry->voice2);
-                        activeTuplets.emplace_back(tuplet, index);
+                    auto addTuplets = [&](const auto& tuplets) {
+                        for (const auto& tuplet : tuplets) {
+                            size_t index = entryFrame->tupletInfo.size();
+                            entryFrame->tupletInfo.emplace_back(*entryFrame, tuplet, i, actualElapsedDuration, entry->voice2);
+                            activeTuplets.emplace_back(tuplet, index);
+                        }
+                    };
+                    if (const auto sortedTuplets = document->getSortedTuplets(getRequestedPartId(), entry->getEntryNumber())) {
+                        addTuplets(*sortedTuplets);
+                    } else {
+                        auto tuplets = document->getDetails()->getArray<details::TupletDef>(getRequestedPartId(), entry->getEntryNumber());
+                        std::stable_sort(tuplets.begin(), tuplets.end(), [](const auto& a, const auto& b) {
+                            return a->calcReferenceDuration() > b->calcReferenceDuration(); // Sort descending by reference duration
+                        });
+                        addTuplets(tuplets);
                     }
                 }
 
@@ -2681,7 +2906,7 @@ ClefIndex details::GFrameHoldContext::calcClefIndexAt(Edu position) const
         return m_hold->clefId.value();
     }
     ClefIndex result = 0;
-    auto clefList = m_hold->getDocument()->getOthers()->getArray<others::ClefList>(getRequestedPartId(), m_hold->clefListId);
+    auto clefList = m_hold->getDocumentRef().getOthers()->getArray<others::ClefList>(getRequestedPartId(), m_hold->clefListId);
     if (clefList.empty()) {
         MUSX_INTEGRITY_ERROR("GFrameHold for staff " + std::to_string(m_hold->getStaff()) + " and measure "
             + std::to_string(m_hold->getMeasure()) + " has non-existent clef list [" + std::to_string(m_hold->clefListId) + "]");
@@ -2785,63 +3010,35 @@ bool details::GFrameHoldContext::calcVoicingIncludesLayer(LayerIndex layerIndex)
 
 std::pair<int, int> Note::calcDefaultEnharmonic(const MusxInstance<KeySignature>& key) const
 {
-    auto createReturnVal = [&](int steps) -> std::pair<int, int> {
-        auto noteTransposer = key->createTransposer(harmLev, harmAlt);
-        noteTransposer->enharmonicTranspose(steps);
-        if (std::abs(noteTransposer->alteration()) > MAX_ALTERATIONS) {
-            return { harmLev, harmAlt };
-        }
-        return { noteTransposer->displacement(), noteTransposer->alteration() };
-    };
-
-    if (harmAlt != 0) {
-        return createReturnVal(music_theory::sign(harmAlt));
-    }
-
-    const auto pitch = key->calcPitch(harmLev, harmAlt, KeySignature::KeyContext::Concert);
-    auto up = music_theory::Transposer(pitch);
-    up.enharmonicTranspose(1);
-    auto down = music_theory::Transposer(pitch);
-    down.enharmonicTranspose(-1);
-
-    if (std::abs(down.alteration()) < std::abs(up.alteration())) {
-        return createReturnVal(-1);
-    }
-
-    return createReturnVal(1);
+    return key->calcDefaultEnharmonic(harmLev, harmAlt);
 }
 
 Note::NoteProperties Note::calcNoteProperties(const MusxInstance<KeySignature>& key, KeySignature::KeyContext ctx, ClefIndex clefIndex,
     const MusxInstance<others::PercussionNoteInfo>& percNoteInfo, const MusxInstance<others::Staff>& staff, bool respellEnharmonic) const
 {
-    auto [transposedLev, transposedAlt] = respellEnharmonic
-                                        ? calcDefaultEnharmonic(key)
-                                        : std::pair<int, int>{ harmLev, harmAlt };
-    if (staff && staff->transposition && staff->transposition->chromatic) {
-        const auto& chromatic = *staff->transposition->chromatic;
-        auto transposer = key->createTransposer(transposedLev, transposedAlt);
-        transposer->chromaticTranspose(chromatic.diatonic, chromatic.alteration);
-        transposedLev = transposer->displacement();
-        transposedAlt = transposer->alteration();
-    }
-
-    const auto pitch = key->calcPitch(transposedLev, transposedAlt, ctx);
-    int keyAdjustedLev = key->calcTonalCenterIndex(ctx) + transposedLev + (key->getOctaveDisplacement(ctx) * music_theory::STANDARD_DIATONIC_STEPS);
+    const auto [chromaticInterval, chromaticAlteration] = [&]() -> std::pair<int, int> {
+        if (staff && staff->transposition && staff->transposition->chromatic) {
+            const auto& chromatic = *staff->transposition->chromatic;
+            return { chromatic.diatonic, chromatic.alteration };
+        }
+        return { 0, 0 };
+    }();
+    const auto spelling = key->calcNoteSpelling(harmLev, harmAlt, ctx, respellEnharmonic, chromaticInterval, chromaticAlteration);
 
     // Calculate the staff line
     const int staffLine = [&]() {
         if (percNoteInfo) {
             return percNoteInfo->calcStaffReferencePosition();
         }
-        const auto& clefOptions = getDocument()->getOptions()->get<options::ClefOptions>();
+        const auto& clefOptions = getDocumentRef().getOptions()->get<options::ClefOptions>();
         if (!clefOptions) {
             throw std::invalid_argument("Document contains no clef options!");
         }
         int middleCLine = clefOptions->getClefDef(clefIndex)->middleCPos;
-        return keyAdjustedLev + middleCLine;
+        return spelling.middleCOffset + middleCLine;
     }();
 
-    return { pitch.noteName, pitch.octave, pitch.alteration, staffLine };
+    return { spelling.pitch.noteName, spelling.pitch.octave, spelling.pitch.alteration, staffLine };
 }
 
 // ***********************
@@ -3053,6 +3250,13 @@ StaffCmper NoteInfoPtr::calcStaff() const
 }
 
 Note::NoteProperties NoteInfoPtr::calcNoteProperties(NotePropertiesOptions options) const
+{
+    const auto context = calcPitchContext(options);
+    return (*this)->calcNoteProperties(context.key, context.keyContext, context.clefIndex, context.percussionNoteInfo,
+        context.transposingStaff, context.respellEnharmonic);
+}
+
+NoteInfoPtr::PitchContext NoteInfoPtr::calcPitchContext(NotePropertiesOptions options) const
 {
     StaffCmper staffId = getEntryInfo().getStaff();
     if (!options.alwaysUseEntryStaff) {
@@ -3076,8 +3280,7 @@ Note::NoteProperties NoteInfoPtr::calcNoteProperties(NotePropertiesOptions optio
         }
     }();
     const auto keyContext = forWrittenPitch ? KeySignature::KeyContext::Written : KeySignature::KeyContext::Concert;
-    return (*this)->calcNoteProperties(m_entry.getKeySignature(), keyContext, clefIndex, calcPercussionNoteInfo(),
-        forWrittenPitch ? staff : nullptr, respell);
+    return { m_entry.getKeySignature(), keyContext, clefIndex, calcPercussionNoteInfo(), forWrittenPitch ? staff : nullptr, respell };
 }
 
 MusxInstance<others::PercussionNoteInfo> NoteInfoPtr::calcPercussionNoteInfo() const
@@ -3087,8 +3290,8 @@ MusxInstance<others::PercussionNoteInfo> NoteInfoPtr::calcPercussionNoteInfo() c
         if (auto currStaff = getEntryInfo().createCurrentStaff()) {
             if (currStaff->percussionMapId.has_value()) {
                 const Cmper partId = getEntryInfo().getFrame()->getRequestedPartId();
-                if (auto noteCode = entry->getDocument()->getDetails()->getForNote<details::PercussionNoteCode>(*this, partId)) {
-                    auto percNoteInfoList = entry->getDocument()->getOthers()->getArray<others::PercussionNoteInfo>(partId, currStaff->percussionMapId.value());
+                if (auto noteCode = entry->getDocumentRef().getDetails()->getForNote<details::PercussionNoteCode>(*this, partId)) {
+                    auto percNoteInfoList = entry->getDocumentRef().getOthers()->getArray<others::PercussionNoteInfo>(partId, currStaff->percussionMapId.value());
                     for (const auto& percNoteInfo : percNoteInfoList) {
                         if (noteCode->noteCode == percNoteInfo->percNoteType) {
                             return percNoteInfo;
@@ -3179,7 +3382,7 @@ bool NoteInfoPtr::calcIsEnharmonicRespell() const
 {
     auto entry = m_entry->getEntry();
     if (entry->noteDetail) {
-        if (auto noteAlts = entry->getDocument()->getDetails()->getForNote<details::NoteAlterations>(*this)) {
+        if (auto noteAlts = entry->getDocumentRef().getDetails()->getForNote<details::NoteAlterations>(*this)) {
             return noteAlts->enharmonic;
         }
     }
@@ -3239,7 +3442,7 @@ int NoteInfoPtr::calcCrossStaffDirection(DeferredReference<MusxInstanceList<othe
     const auto frame = getEntryInfo().getFrame();
 
     if (!staffList) {
-        staffList.emplace(frame->getDocument()->getScrollViewStaves(frame->getRequestedPartId()));
+        staffList.emplace(frame->getDocumentRef().getScrollViewStaves(frame->getRequestedPartId()));
     }
 
     const auto homeIndex = staffList->getIndexForStaff(frame->getStaff());
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <tuple>
 #include <utility>
@@ -32,6 +33,13 @@
 #include "CommonClasses.h"
  // do not add other dom class dependencies. Use Implementations.h for implementations that need total class access.
 
+#ifdef MUSX_COMPACT_ENTRIES
+/// @brief Makes the boolean members of @ref musx::dom::Entry and @ref musx::dom::Note one-bit fields.
+#define MUSX_ENTRY_FLAG_BITS : 1
+#else
+#define MUSX_ENTRY_FLAG_BITS
+#endif
+
 namespace music_theory {
 enum class NoteName : int;
 class Transposer;
@@ -263,6 +271,8 @@ unsigned calcNumberOfBeamsInEdu(Edu duration);
  * @class Note
  * @brief Represents a single note element in an entry.
  *
+ * When `MUSX_COMPACT_ENTRIES` is defined, the boolean members are one-bit fields, so references and pointers to them cannot be formed.
+ *
  * This class is identified by the XML node name "note".
  */
 class Note : public EnigmaBase
@@ -270,7 +280,11 @@ class Note : public EnigmaBase
 public:
     /** @brief Constructor function */
     explicit Note(const DocumentWeakPtr& document, NoteNumber noteId)
-        : EnigmaBase(document, 0, ShareMode::All), m_noteId(noteId)
+        : EnigmaBase(document, 0, ShareMode::All),
+          isValid(false), tieStart(false), tieEnd(false), crossStaff(false), upStemSecond(false),
+          downStemSecond(false), upSplitStem(false), showAcci(false), parenAcci(false), noPlayback(false),
+          noSpacing(false), freezeAcci(false), playDisabledByHP(false),
+          m_noteId(noteId)
     {
     }
 
@@ -300,22 +314,22 @@ public:
 
     int harmLev{};      ///< Diatonic displacement relative to middle C or to the tonic in the middle C octave (if the key signature tonic is not C).
     int harmAlt{};      ///< Chromatic alteration relative to the key signature. Never has a magnitude greater than +/-7.
-    bool isValid{};     ///< Should always be true but otherwise appears to be used internally by Finale.
-    bool tieStart{};    ///< Indicates a tie starts on this note.
-    bool tieEnd{};      ///< Indicates a tie ends on this note.
-    bool crossStaff{};  ///< Signifies that the note has a @ref details::CrossStaff note detail.
-    bool upStemSecond{}; ///< Indicates that this note is the upper note of a second.
+    bool isValid MUSX_ENTRY_FLAG_BITS;   ///< Should always be true but otherwise appears to be used internally by Finale.
+    bool tieStart MUSX_ENTRY_FLAG_BITS;  ///< Indicates a tie starts on this note.
+    bool tieEnd MUSX_ENTRY_FLAG_BITS;    ///< Indicates a tie ends on this note.
+    bool crossStaff MUSX_ENTRY_FLAG_BITS; ///< Signifies that the note has a @ref details::CrossStaff note detail.
+    bool upStemSecond MUSX_ENTRY_FLAG_BITS; ///< Indicates that this note is the upper note of a second.
                         ///< When the entry is upstem, it is drawn on the "wrong" side of the stem.
-    bool downStemSecond{}; ///< Indicates that this note is the lower note of a second.
+    bool downStemSecond MUSX_ENTRY_FLAG_BITS; ///< Indicates that this note is the lower note of a second.
                         ///< When the entry is downstem, it is drawn on the "wrong" side of the stem.
-    bool upSplitStem{}; ///< True if the stem splits on this note. To split a chord in the normal way, every note from this higher
+    bool upSplitStem MUSX_ENTRY_FLAG_BITS; ///< True if the stem splits on this note. To split a chord in the normal way, every note from this higher
                         ///< should have #upSplitStem set to `true`. Only takes effect if #Entry::splitStem is `true`.
-    bool showAcci{};    ///< True if the note has an accidental. (Dynamically changed by Finale unless `freezeAcci` is set.)
-    bool parenAcci{};   ///< True if the accidental has parentheses.
-    bool noPlayback{};  ///< Indicates that this note should not be played back.
-    bool noSpacing{};   ///< Indicates that this note should ignored when calculating spacing.
-    bool freezeAcci{};  ///< True if the accidental should be forced on or off (based on `showAcci`.)
-    bool playDisabledByHP{}; ///< Used by Finale's smart playback engine.
+    bool showAcci MUSX_ENTRY_FLAG_BITS;  ///< True if the note has an accidental. (Dynamically changed by Finale unless `freezeAcci` is set.)
+    bool parenAcci MUSX_ENTRY_FLAG_BITS; ///< True if the accidental has parentheses.
+    bool noPlayback MUSX_ENTRY_FLAG_BITS; ///< Indicates that this note should not be played back.
+    bool noSpacing MUSX_ENTRY_FLAG_BITS; ///< Indicates that this note should ignored when calculating spacing.
+    bool freezeAcci MUSX_ENTRY_FLAG_BITS; ///< True if the accidental should be forced on or off (based on `showAcci`.)
+    bool playDisabledByHP MUSX_ENTRY_FLAG_BITS; ///< Used by Finale's smart playback engine.
 
     /// @brief Gets the note id for this note. This value does not change, even if the notes
     /// in a chord are rearranged (which affects the order of #Entry::notes.)
@@ -374,6 +388,9 @@ private:
  * @class Entry
  * @brief Represents an entry containing metadata and notes.
  *
+ * When `MUSX_COMPACT_ENTRIES` is defined, the boolean members are one-bit fields packed into a few bytes,
+ * so references and pointers to them cannot be formed.
+ *
  * This class is identified by the XML node name "entry".
  */
 class Entry : public EnigmaBase
@@ -384,7 +401,15 @@ public:
      * The partId and shareMode values should always be 0 and ShareMode::All, but they are required by the factory function.
     */
     explicit Entry(const DocumentWeakPtr& document, Cmper partId, ShareMode shareMode, EntryNumber entnum, EntryNumber prev, EntryNumber next)
-        : EnigmaBase(document, partId, shareMode), m_entnum(entnum), m_prev(prev), m_next(next)
+        : EnigmaBase(document, partId, shareMode),
+          isValid(false), isNote(false), v2Launch(false), voice2(false), createdByHP(false), playDisabledByHP(false),
+          graceNote(false), noteDetail(false), articDetail(false), lyricDetail(false), tupletStart(false),
+          splitRest(false), performanceData(false), floatRest(false), isHidden(false), beamExt(false), flipTie(false),
+          dotTieAlt(false), beam(false), secBeam(false), freezeStemScore(false), stemDetail(false), crossStaff(false),
+          reverseUpStem(false), reverseDownStem(false), doubleStem(false), splitStem(false), upStemScore(false),
+          checkAccis(false), dummy(false), smartShapeDetail(false), noLeger(false), sorted(false), slashGrace(false),
+          flatBeam(false), noPlayback(false), noSpacing(false), freezeBeam(false),
+          m_entnum(entnum), m_prev(prev), m_next(next)
     {
     }
 
@@ -399,48 +424,48 @@ public:
     Edu duration{};
     int numNotes{};          ///< Number of notes in the entry. There is an error if this is not the same as notes.size().
     Evpu hOffsetScore{};     ///< Manual offset created with the Note Position Tool in the score. (xml node is `<posi>`.)
-    bool isValid{};          ///< Should always be true but otherwise appears to be used internally by Finale.
-    bool isNote{};           ///< If this value is false, the entry is a rest.
-    bool v2Launch{};         ///< Indicates if this entry (which is voice1) launches a voice2 sequence. (xml node is `<controller>`)
-    bool voice2{};           ///< This is a V2 note. (xml node `<v2>`)
-    bool createdByHP{};      ///< Indicates the entry was created by Finale's smart playback engine.
-    bool playDisabledByHP{}; ///< Used by Finale's smart playback engine.
-    bool graceNote{};        ///< Indicate the entry is a grace note.
-    bool noteDetail{};       ///< Indicates there is a note detail or EntrySize record for the entry.
-    bool articDetail{};      ///< Indicates there is an articulation on the entry
-    bool lyricDetail{};      ///< Indicates there is a lyric assignment on the entry.
-    bool tupletStart{};      ///< Indicates that a tuplet start on the entry.
-    bool splitRest{};        ///< Indicates that rests in different layers are not combined on this entry.
-    bool performanceData{};  ///< Indicates there is performance data on the entry.
-    bool floatRest{};        ///< Is floating rest. If false, the first note element gives the staff position of the rest.
-    bool isHidden{};         ///< Indicates the entry is hidden, (xml node is `<ignore>`)
-    bool beamExt{};          ///< Indicates that there is a beam extension on the entry.
-    bool flipTie{};          ///< Indicates the existence of a flipped tie, either in Speedy Entry or Layer Attributes.
-    bool dotTieAlt{};        ///< Indicates dot or tie alterations are present.
-    bool beam{};             ///< Signifies the start of a beam or singleton entry. (That is, any beam breaks at this entry.)
-    bool secBeam{};          ///< Signifies a secondary beam break occurs on the entry.
-    bool freezeStemScore{};  ///< Freeze stem flag in the score. (#upStemScore gives the direction.)
-    bool stemDetail{};       ///< Indicates there are stem modifications.
-    bool crossStaff{};       ///< Signifies that at least one note in the entry has been cross staffed.
-    bool reverseUpStem{};    ///< Indicates that a stem normally up is reversed.
-    bool reverseDownStem{};  ///< Indicates that a stem normally down is reversed.
-    bool doubleStem{};       ///< Creates a double stem on the entry. (Appears to be exclusive with #splitStem.)
-    bool splitStem{};        ///< Indicates the presence of a note with #Note::upSplitStem set.
+    bool isValid MUSX_ENTRY_FLAG_BITS;        ///< Should always be true but otherwise appears to be used internally by Finale.
+    bool isNote MUSX_ENTRY_FLAG_BITS;         ///< If this value is false, the entry is a rest.
+    bool v2Launch MUSX_ENTRY_FLAG_BITS;       ///< Indicates if this entry (which is voice1) launches a voice2 sequence. (xml node is `<controller>`)
+    bool voice2 MUSX_ENTRY_FLAG_BITS;         ///< This is a V2 note. (xml node `<v2>`)
+    bool createdByHP MUSX_ENTRY_FLAG_BITS;    ///< Indicates the entry was created by Finale's smart playback engine.
+    bool playDisabledByHP MUSX_ENTRY_FLAG_BITS; ///< Used by Finale's smart playback engine.
+    bool graceNote MUSX_ENTRY_FLAG_BITS;      ///< Indicate the entry is a grace note.
+    bool noteDetail MUSX_ENTRY_FLAG_BITS;     ///< Indicates there is a note detail or EntrySize record for the entry.
+    bool articDetail MUSX_ENTRY_FLAG_BITS;    ///< Indicates there is an articulation on the entry
+    bool lyricDetail MUSX_ENTRY_FLAG_BITS;    ///< Indicates there is a lyric assignment on the entry.
+    bool tupletStart MUSX_ENTRY_FLAG_BITS;    ///< Indicates that a tuplet start on the entry.
+    bool splitRest MUSX_ENTRY_FLAG_BITS;      ///< Indicates that rests in different layers are not combined on this entry.
+    bool performanceData MUSX_ENTRY_FLAG_BITS; ///< Indicates there is performance data on the entry.
+    bool floatRest MUSX_ENTRY_FLAG_BITS;      ///< Is floating rest. If false, the first note element gives the staff position of the rest.
+    bool isHidden MUSX_ENTRY_FLAG_BITS;       ///< Indicates the entry is hidden, (xml node is `<ignore>`)
+    bool beamExt MUSX_ENTRY_FLAG_BITS;        ///< Indicates that there is a beam extension on the entry.
+    bool flipTie MUSX_ENTRY_FLAG_BITS;        ///< Indicates the existence of a flipped tie, either in Speedy Entry or Layer Attributes.
+    bool dotTieAlt MUSX_ENTRY_FLAG_BITS;      ///< Indicates dot or tie alterations are present.
+    bool beam MUSX_ENTRY_FLAG_BITS;           ///< Signifies the start of a beam or singleton entry. (That is, any beam breaks at this entry.)
+    bool secBeam MUSX_ENTRY_FLAG_BITS;        ///< Signifies a secondary beam break occurs on the entry.
+    bool freezeStemScore MUSX_ENTRY_FLAG_BITS; ///< Freeze stem flag in the score. (#upStemScore gives the direction.)
+    bool stemDetail MUSX_ENTRY_FLAG_BITS;     ///< Indicates there are stem modifications.
+    bool crossStaff MUSX_ENTRY_FLAG_BITS;     ///< Signifies that at least one note in the entry has been cross staffed.
+    bool reverseUpStem MUSX_ENTRY_FLAG_BITS;  ///< Indicates that a stem normally up is reversed.
+    bool reverseDownStem MUSX_ENTRY_FLAG_BITS; ///< Indicates that a stem normally down is reversed.
+    bool doubleStem MUSX_ENTRY_FLAG_BITS;     ///< Creates a double stem on the entry. (Appears to be exclusive with #splitStem.)
+    bool splitStem MUSX_ENTRY_FLAG_BITS;      ///< Indicates the presence of a note with #Note::upSplitStem set.
                              ///< If no note has a split stem, it shows as a double stem. (Appears to be exclusive with #doubleStem.)
-    bool upStemScore{};      ///< Whether a stem is up or down as set in the score. (Only reliable when #freezeStemScore is true.)
-    bool checkAccis{};       ///< Used by Finale to convert pre-2014 `.mus` files. May never be saved in `.musx`.
-    bool dummy{};            ///< An entry (usually a rest) inserted for alignment. It may not be meaningful outside the Finale runtime environment
+    bool upStemScore MUSX_ENTRY_FLAG_BITS;    ///< Whether a stem is up or down as set in the score. (Only reliable when #freezeStemScore is true.)
+    bool checkAccis MUSX_ENTRY_FLAG_BITS;     ///< Used by Finale to convert pre-2014 `.mus` files. May never be saved in `.musx`.
+    bool dummy MUSX_ENTRY_FLAG_BITS;          ///< An entry (usually a rest) inserted for alignment. It may not be meaningful outside the Finale runtime environment
                              ///< and is probably safe to ignore.
-    bool smartShapeDetail{}; ///< Indicates this entry has a smart shape assignment.
-    bool noLeger{};          ///< Hide ledger lines.
-    bool sorted{};           ///< Sorted flag.
-    bool slashGrace{};       ///< Indicates that a non-beamed grace note with flags (8th note or smaller) should have a slash on the stem.
+    bool smartShapeDetail MUSX_ENTRY_FLAG_BITS; ///< Indicates this entry has a smart shape assignment.
+    bool noLeger MUSX_ENTRY_FLAG_BITS;        ///< Hide ledger lines.
+    bool sorted MUSX_ENTRY_FLAG_BITS;         ///< Sorted flag.
+    bool slashGrace MUSX_ENTRY_FLAG_BITS;     ///< Indicates that a non-beamed grace note with flags (8th note or smaller) should have a slash on the stem.
                              ///< If #options::GraceNoteOptions::slashFlaggedGraceNotes is true, this option has no effect. The stem
                              ///< always has a slash in that case.
-    bool flatBeam{};         ///< Forces any beam that starts on this entry to be flat by default.
-    bool noPlayback{};       ///< Indicates that the entry should not be played back.
-    bool noSpacing{};        ///< Indicates that the entry should be ignored when calculating music spacing.
-    bool freezeBeam{};       ///< Freeze beam flag (Derived from the presence of `<freezeBeam>` node.)
+    bool flatBeam MUSX_ENTRY_FLAG_BITS;       ///< Forces any beam that starts on this entry to be flat by default.
+    bool noPlayback MUSX_ENTRY_FLAG_BITS;     ///< Indicates that the entry should not be played back.
+    bool noSpacing MUSX_ENTRY_FLAG_BITS;      ///< Indicates that the entry should be ignored when calculating music spacing.
+    bool freezeBeam MUSX_ENTRY_FLAG_BITS;     ///< Freeze beam flag (Derived from the presence of `<freezeBeam>` node.)
 
     /** @brief Collection of notes that comprise the entry. These are in order from lowest to highest. */
     std::vector<std::shared_ptr<Note>> notes;
@@ -518,6 +543,17 @@ public:
     /// @param document The document to search.
     static void calcLocations(const DocumentPtr& document);
 
+    /// @brief Recalculates the locations for the entries in one staff's frames over a range of measures.
+    ///
+    /// Entries that were located in those frames but are no longer in them lose their location. The entry arena
+    /// is not rebuilt, since it falls back to the entry list wherever it no longer matches. This function is
+    /// normally only called by @ref factory::DocumentFactory::refresh.
+    /// @param document The document to search.
+    /// @param staffId The staff whose frames changed.
+    /// @param startMeas The first measure whose frame changed.
+    /// @param endMeas The last measure whose frame changed (inclusive).
+    static void calcLocations(const DocumentPtr& document, StaffCmper staffId, MeasCmper startMeas, MeasCmper endMeas);
+
     constexpr static std::string_view XmlNodeName = "entry"; ///< The XML node name for this type.
     static const xml::XmlElementArray<Entry>& xmlMappingArray(); ///< Required for musx::factory::FieldPopulator.
 
@@ -525,6 +561,9 @@ private:
     EntryNumber m_entnum{}; ///< Entry number.
     EntryNumber m_prev{};   ///< Previous entry number in the list. (0 if none)
     EntryNumber m_next{};   ///< Next entry number in the list. (0 if none)
+    size_t m_arenaSlot{ (std::numeric_limits<size_t>::max)() }; ///< This entry's slot in the @ref EntryPool arena.
+
+    friend class EntryPool;
 };
 
 class EntryInfo;
@@ -1237,6 +1276,53 @@ public:
     }
 };
 
+/**
+ * @class EntryInfoResolver
+ * @brief Resolves entry numbers to @ref EntryInfoPtr instances, reusing each entry frame it builds.
+ *
+ * #EntryInfoPtr::fromEntryNumber builds the entire entry frame for every call. A resolver keeps the frames it has built,
+ * keyed by staff, measure, and layer, so resolving any number of entries in the same layer of a measure builds that frame
+ * only once. Create one for a batch of lookups and discard it afterwards. It does not observe changes to the document.
+ */
+class EntryInfoResolver
+{
+public:
+    /// @brief Constructor
+    /// @param document The document to search.
+    /// @param partId The part for which to create the #EntryInfoPtr instances.
+    /// @param timeOffset Subtract this amount from elapsed durations. (See #EntryInfoPtr::fromEntryNumber.)
+    EntryInfoResolver(const DocumentPtr& document, Cmper partId, util::Fraction timeOffset = 0)
+        : m_document(document), m_partId(partId), m_timeOffset(timeOffset) {}
+
+    /// @brief Returns an EntryInfoPtr for the entry specified by @p entryNumber, with the same semantics as #EntryInfoPtr::fromEntryNumber.
+    [[nodiscard]]
+    EntryInfoPtr resolve(EntryNumber entryNumber);
+
+    /// @brief Returns the entry frame for the specified location, building it if it has not been built yet.
+    /// @return The entry frame or null if the location has no entries in the requested part.
+    [[nodiscard]]
+    std::shared_ptr<const EntryFrame> getFrame(StaffCmper staffId, MeasCmper measureId, LayerIndex layerIndex);
+
+    /// @brief Returns the part for which the resolver creates #EntryInfoPtr instances.
+    [[nodiscard]]
+    Cmper getRequestedPartId() const { return m_partId; }
+
+    /// @brief Returns the number of frame locations that have been looked up so far.
+    [[nodiscard]]
+    size_t getFrameCount() const { return m_frames.size(); }
+
+    /// @brief Discards every frame built so far.
+    void clear() { m_frames.clear(); }
+
+private:
+    using FrameKey = std::tuple<StaffCmper, MeasCmper, LayerIndex>;
+
+    DocumentPtr m_document;
+    Cmper m_partId{};
+    util::Fraction m_timeOffset;
+    std::map<FrameKey, std::shared_ptr<const EntryFrame>> m_frames; ///< Null frames are kept so that failed lookups are not repeated.
+};
+
 /**
  * @class EntryFrame
  * @brief Represents a vector of @ref EntryInfo instances for a given frame, along with computed information.
@@ -1262,6 +1348,9 @@ public:
     }
 
     /// @brief class to track tuplets in the frame
+    ///
+    /// A TupletInfo refers to the frame that owns it without owning or locking it. It is only valid while that frame
+    /// is alive, so do not keep a copy after releasing the last @ref EntryInfoPtr or frame pointer to the frame.
     struct TupletInfo
     {
         MusxInstance<details::TupletDef> tuplet;  ///< the tuplet
@@ -1272,9 +1361,10 @@ public:
         bool voice2;                                    ///< whether this tuplet is for voice2
 
         /// @brief Constructor
-        TupletInfo(const std::weak_ptr<const EntryFrame>& parent, const MusxInstance<details::TupletDef>& tup, size_t index, util::Fraction start, bool forVoice2)
+        /// @param parent The frame that owns this record. The record refers to it without owning it, so it must not outlive the frame.
+        TupletInfo(const EntryFrame& parent, const MusxInstance<details::TupletDef>& tup, size_t index, util::Fraction start, bool forVoice2)
             : tuplet(tup), startIndex(index), endIndex((std::numeric_limits<size_t>::max)()),
-                startDura(start), endDura(-1), voice2(forVoice2), m_parent(parent)
+                startDura(start), endDura(-1), voice2(forVoice2), m_parent(&parent)
         {}
 
         /// @brief Return the number of entries in the tuplet
@@ -1324,7 +1414,12 @@ public:
         ///     - Ignore the entry's next neighbor in the same voice. It will have its leger lines suppressed and non-visible notehead(s) and stem.
         /// Its `hidden` flag, however, will still be false. (This function guarantees these conditions if it returns `true`.)
         [[nodiscard]]
-        bool calcCreatesSingletonBeamRight() const { return calcCreatesSingleton(false); }
+        bool calcCreatesSingletonBeamRight() const { return calcCreatesSingleton(getParent().shared_from_this(), false); }
+
+        /// @brief Same as #calcCreatesSingletonBeamRight, for callers that already hold the owning frame.
+        /// @param frame The frame that owns this tuplet.
+        [[nodiscard]]
+        bool calcCreatesSingletonBeamRight(const std::shared_ptr<const EntryFrame>& frame) const { return calcCreatesSingleton(frame, false); }
 
         /// @brief Calculates if this tuplet is being used to create a singleton beam to the left.
         ///
@@ -1336,7 +1431,12 @@ public:
         ///     - The current entry with the 0-length tuplet will have its leger lines suppressed and non-visible notehead(s) and stem.
         /// Its `hidden` flag, however, will still be false. (This function guarantees these conditions if it returns `true`.)
         [[nodiscard]]
-        bool calcCreatesSingletonBeamLeft() const { return calcCreatesSingleton(true); }
+        bool calcCreatesSingletonBeamLeft() const { return calcCreatesSingleton(getParent().shared_from_this(), true); }
+
+        /// @brief Same as #calcCreatesSingletonBeamLeft, for callers that already hold the owning frame.
+        /// @param frame The frame that owns this tuplet.
+        [[nodiscard]]
+        bool calcCreatesSingletonBeamLeft(const std::shared_ptr<const EntryFrame>& frame) const { return calcCreatesSingleton(frame, true); }
 
         /// @brief Detects tuplets being used to create time stretch in an independent time signature.
         ///
@@ -1354,19 +1454,13 @@ public:
 
     private:
         [[nodiscard]]
-        bool calcCreatesSingleton(bool left) const;
+        bool calcCreatesSingleton(const std::shared_ptr<const EntryFrame>& frame, bool left) const;
 
+        /// @brief Returns the owning frame. The frame must still be alive.
         [[nodiscard]]
-        const std::shared_ptr<const EntryFrame> getParent() const
-        {
-            auto result = m_parent.lock();
-            MUSX_ASSERT_IF(!result) {
-                throw std::logic_error("Unable to obtain lock on parent entry frame.");
-            }
-            return result;
-        }
+        const EntryFrame& getParent() const { return *m_parent; }
 
-        const std::weak_ptr<const EntryFrame> m_parent;
+        const EntryFrame* m_parent; ///< Non-owning. The parent frame owns this record.
     };
 
     /** @brief A list of the tuplets in the frame and their calculated starting and ending information.
@@ -1385,6 +1479,10 @@ public:
     [[nodiscard]]
     DocumentPtr getDocument() const;
 
+    /// @brief Get the document for the entry frame without changing its reference count. (See @ref DocumentElement::getDocumentRef.)
+    [[nodiscard]]
+    Document& getDocumentRef() const;
+
     /// @brief Get the frame context for this frame
     [[nodiscard]]
     const details::GFrameHoldContext& getContext() const { return m_context; }
@@ -1676,6 +1774,24 @@ public:
     [[nodiscard]]
     Note::NoteProperties calcNoteProperties(NotePropertiesOptions options = {}) const;
 
+    /// @struct PitchContext
+    /// @brief The contextual inputs that #calcNoteProperties passes to #Note::calcNoteProperties.
+    struct PitchContext
+    {
+        MusxInstance<KeySignature> key;                                 ///< The key signature of the entry's frame.
+        KeySignature::KeyContext keyContext{};                          ///< Whether written or concert key values apply.
+        ClefIndex clefIndex{};                                          ///< The clef that applies to the note.
+        MusxInstance<others::PercussionNoteInfo> percussionNoteInfo;    ///< The percussion note info, if any.
+        MusxInstance<others::Staff> transposingStaff;                   ///< The staff whose chromatic transposition applies, or null for concert pitch.
+        bool respellEnharmonic{};                                       ///< True if the note is enharmonically respelled.
+    };
+
+    /// @brief Resolves the key, clef, transposition, and respelling that determine this note's pitch and staff position.
+    /// This is useful for bulk pitch calculations that need the same inputs as #calcNoteProperties.
+    /// @param options Calculation options, including pitch representation, enharmonic behavior, and cross-staff handling.
+    [[nodiscard]]
+    PitchContext calcPitchContext(NotePropertiesOptions options = {}) const;
+
     /// @brief Calculates the percussion note info for this note, if any.
     /// @return If the note is on a percussion staff and has percussion note info assigned, returns it. Otherwise `nullptr`.
     [[nodiscard]]
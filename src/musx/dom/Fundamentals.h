@@ -38,13 +38,13 @@
 #ifdef MUSX_THROW_ON_INTEGRITY_CHECK_FAIL
 #define MUSX_INTEGRITY_ERROR(S) throw ::musx::dom::integrity_error(S)
 #else
-#define MUSX_INTEGRITY_ERROR(S) ::musx::util::Logger::log(::musx::util::Logger::LogLevel::Warning, (S))
+#define MUSX_INTEGRITY_ERROR(S) ::musx::util::Logger::log(::musx::util::Logger::LogLevel::Warning, [&]() -> std::string { return (S); })
 #endif
 
 #ifdef MUSX_THROW_ON_UNKNOWN_XML
 #define MUSX_UNKNOWN_XML(S) throw ::musx::factory::unknown_xml_error(S)
 #else
-#define MUSX_UNKNOWN_XML(S) ::musx::util::Logger::log(::musx::util::Logger::LogLevel::Warning, (S))
+#define MUSX_UNKNOWN_XML(S) ::musx::util::Logger::log(::musx::util::Logger::LogLevel::Warning, [&]() -> std::string { return (S); })
 #endif
 
 #define MUSX_ASSERT_IF(TEST) \
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/dom/GlobalTimeline.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "musx/musx.h"
+
+namespace musx {
+namespace dom {
+
+GlobalTimeline::GlobalTimeline(const DocumentPtr& document, Cmper partId)
+{
+    // Measure cmpers are normally sequential starting with 1 (see others::Measure::checkMeasureCmperSequence),
+    // but any gaps are kept as zero-length measures so that measure ids index the arrays directly.
+    const auto measures = document->getOthers()->getArray<others::Measure>(partId);
+    MeasCmper measureCount = 0;
+    for (const auto& measure : measures) {
+        measureCount = (std::max)(measureCount, MeasCmper(measure->getCmper()));
+    }
+    std::vector<MusxInstance<others::Measure>> measuresById(static_cast<size_t>(measureCount));
+    m_measureDurations.resize(size_t(measureCount));
+    for (const auto& measure : measures) {
+        if (measure->getCmper() == 0) {
+            continue;
+        }
+        const size_t index = size_t(measure->getCmper()) - 1;
+        measuresById[index] = measure;
+        m_measureDurations[index] = measure->calcDuration();
+    }
+    m_measureStarts.reserve(m_measureDurations.size() + 1);
+    m_measureStarts.push_back(0);
+    for (const auto& duration : m_measureDurations) {
+        m_measureStarts.push_back(m_measureStarts.back() + duration);
+    }
+
+    // Only staves with an independent time signature can have a time stretch other than 1.
+    for (const auto& floats : document->getDetails()->getArray<details::IndependentStaffDetails>(partId)) {
+        if (!floats->hasTime) {
+            continue;
+        }
+        const auto staffId = StaffCmper(floats->getCmper1());
+        const auto measureId = MeasCmper(floats->getCmper2());
+        if (measureId < 1 || measureId > measureCount) {
+            continue;
+        }
+        const auto& measure = measuresById[size_t(measureId) - 1];
+        if (!measure) {
+            continue;
+        }
+        auto [row, inserted] = m_staffRows.emplace(staffId, m_timeStretches.size());
+        if (inserted) {
+            m_timeStretches.resize(m_timeStretches.size() + m_measureDurations.size(), 1);
+        }
+        m_timeStretches[row->second + size_t(measureId) - 1] = measure->calcTimeStretch(staffId);
+    }
+}
+
+size_t GlobalTimeline::measureIndex(MeasCmper measureId) const
+{
+    if (measureId < 1 || size_t(measureId) > m_measureDurations.size()) {
+        throw std::out_of_range("Measure " + std::to_string(measureId) + " is not in the global timeline.");
+    }
+    return size_t(measureId) - 1;
+}
+
+util::Fraction GlobalTimeline::getMeasureStart(MeasCmper measureId) const
+{
+    if (size_t(measureId) == m_measureDurations.size() + 1) {
+        return m_measureStarts.back();
+    }
+    return m_measureStarts[measureIndex(measureId)];
+}
+
+util::Fraction GlobalTimeline::getStaffDuration(MeasCmper measureId, StaffCmper staffId) const
+{
+    return getMeasureDuration(measureId) / getTimeStretch(measureId, staffId);
+}
+
+util::Fraction GlobalTimeline::getTimeStretch(MeasCmper measureId, StaffCmper staffId) const
+{
+    const size_t index = measureIndex(measureId);
+    if (const auto it = m_staffRows.find(staffId); it != m_staffRows.end()) {
+        return m_timeStretches[it->second + index];
+    }
+    return 1;
+}
+
+util::Fraction GlobalTimeline::calcAbsolutePosition(const MusicPoint& point) const
+{
+    return getMeasureStart(point.measureId) + point.position;
+}
+
+util::Fraction GlobalTimeline::calcAbsolutePosition(const EntryInfoPtr& entryInfo) const
+{
+    return getMeasureStart(entryInfo.getMeasure()) + entryInfo.calcGlobalElapsedDuration();
+}
+
+std::optional<MusicPoint> GlobalTimeline::calcMusicPoint(util::Fraction absolutePosition) const
+{
+    if (absolutePosition < 0 || absolutePosition >= getTotalDuration()) {
+        return std::nullopt;
+    }
+    // m_measureStarts is non-decreasing, so the containing measure is the last one starting at or before the position.
+    const auto it = std::upper_bound(m_measureStarts.begin(), m_measureStarts.end(), absolutePosition);
+    const size_t index = size_t(std::distance(m_measureStarts.begin(), it)) - 1;
+    return MusicPoint(MeasCmper(index + 1), absolutePosition - m_measureStarts[index]);
+}
+
+} // namespace dom
+} // namespace musx
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "musx/util/Fraction.h"
+#include "BaseClasses.h"
+#include "CommonClasses.h"
+
+namespace musx {
+namespace dom {
+
+class EntryInfoPtr;
+
+/**
+ * @class GlobalTimeline
+ * @brief Precomputed measure timing for a score or linked part.
+ *
+ * The timeline holds, in flat arrays indexed by measure, the global start position and global duration of every
+ * measure, along with the time stretch of every staff that has an independent time signature anywhere in the part.
+ * With these, any staff-relative position in a measure converts to an absolute score time in O(1), without
+ * recreating time signatures or staff composites.
+ *
+ * Absolute times are expressed as fractions of a whole note from the start of measure 1.
+ *
+ * This is not a Finale data class. Obtain it with @ref Document::getGlobalTimeline, which builds it on first use.
+ */
+class GlobalTimeline
+{
+public:
+    /// @brief Builds the timeline for a score or linked part.
+    /// @param document The document to index.
+    /// @param partId The score or linked part to index.
+    GlobalTimeline(const DocumentPtr& document, Cmper partId);
+
+    /// @brief Returns the number of measures in the timeline.
+    [[nodiscard]]
+    MeasCmper getMeasureCount() const { return MeasCmper(m_measureDurations.size()); }
+
+    /// @brief Returns the absolute start time of a measure.
+    /// @param measureId The measure. Passing one past the last measure returns the total duration.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction getMeasureStart(MeasCmper measureId) const;
+
+    /// @brief Returns the global duration of a measure.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction getMeasureDuration(MeasCmper measureId) const { return m_measureDurations[measureIndex(measureId)]; }
+
+    /// @brief Returns the duration of a measure in the staff-level time of @p staffId. This differs from
+    /// #getMeasureDuration only when the staff has an independent time signature in the measure.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction getStaffDuration(MeasCmper measureId, StaffCmper staffId) const;
+
+    /// @brief Returns the factor by which staff-level positions in the measure are multiplied to get global positions.
+    /// This is the same value as @ref others::Measure::calcTimeStretch.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction getTimeStretch(MeasCmper measureId, StaffCmper staffId) const;
+
+    /// @brief Returns the total duration of the part.
+    [[nodiscard]]
+    util::Fraction getTotalDuration() const { return m_measureStarts.back(); }
+
+    /// @brief Converts a staff-relative position within a measure to an absolute time.
+    /// @param measureId The measure.
+    /// @param staffId The staff whose time signature @p staffPosition is expressed in.
+    /// @param staffPosition The staff-level position within the measure.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction calcAbsolutePosition(MeasCmper measureId, StaffCmper staffId, util::Fraction staffPosition) const
+    { return getMeasureStart(measureId) + staffPosition * getTimeStretch(measureId, staffId); }
+
+    /// @brief Converts a global position within a measure to an absolute time.
+    /// @throws std::out_of_range if the measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction calcAbsolutePosition(const MusicPoint& point) const;
+
+    /// @brief Returns the absolute time of an entry's elapsed duration.
+    /// @throws std::out_of_range if the entry's measure is not in the timeline.
+    [[nodiscard]]
+    util::Fraction calcAbsolutePosition(const EntryInfoPtr& entryInfo) const;
+
+    /// @brief Finds the measure and global position within it for an absolute time.
+    /// @param absolutePosition The absolute time.
+    /// @return The location, or std::nullopt if @p absolutePosition is negative or at or after the end of the part.
+    [[nodiscard]]
+    std::optional<MusicPoint> calcMusicPoint(util::Fraction absolutePosition) const;
+
+private:
+    size_t measureIndex(MeasCmper measureId) const;
+
+    std::vector<util::Fraction> m_measureStarts;        ///< Absolute start of each measure, plus the total duration at the end.
+    std::vector<util::Fraction> m_measureDurations;     ///< Global duration of each measure.
+    std::unordered_map<StaffCmper, size_t> m_staffRows; ///< Row offsets into #m_timeStretches for staves with independent time.
+    std::vector<util::Fraction> m_timeStretches;        ///< One row of measure time stretches per staff in #m_staffRows.
+};
+
+} // namespace dom
+} // namespace musx
@@ -72,7 +72,7 @@ MusxInstanceList<PageGraphicAssign> PageGraphicAssign::getArrayForPageId(const D
 
 std::optional<PageCmper> PageGraphicAssign::calcStartPageNumber(Cmper forPartId) const
 {
-    if (auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
+    if (auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
         if (auto calcValue = part->calcPageNumberFromAssignmentId(getCmper() ? getCmper() : startPage)) {
             if (calcValue.value() <= part->numberOfPages) {
                 return calcValue;
@@ -90,7 +90,7 @@ std::optional<PageCmper> PageGraphicAssign::calcStartPageNumber(Cmper forPartId)
 
 std::optional<PageCmper> PageGraphicAssign::calcEndPageNumber(Cmper forPartId) const
 {
-    if (auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
+    if (auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
         if (isMultiAssignedThruLastPage()) {
             return PageCmper(part->numberOfPages);
         }
@@ -23,11 +23,13 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include "CommonClasses.h"
+#include "InstrumentUuids.h"
 
 namespace musx {
 namespace dom {
@@ -70,6 +72,12 @@ InstrumentFamily instrumentFamilyFromUuid(InstrumentUuid uuid);
 /// @brief Returns whether a Finale instrument UUID represents a solo instrument or an ensemble.
 SoloOrEnsemble instrumentSoloOrEnsembleFromUuid(InstrumentUuid uuid);
 
+/// @brief Returns the broad source-domain family for an interned instrument id. (See #calcInstrumentId.)
+InstrumentFamily instrumentFamilyFromId(InstrumentId instrumentId);
+
+/// @brief Returns whether an interned instrument id represents a solo instrument or an ensemble. (See #calcInstrumentId.)
+SoloOrEnsemble instrumentSoloOrEnsembleFromId(InstrumentId instrumentId);
+
 /**
  * @class InstrumentInfo
  * @brief Derived description of a logical instrument in a document.
@@ -128,14 +136,40 @@ public:
     /// Reversion to the base staff instrument is represented by an additional change at the first location
     /// after the staff style assignment. If no changes are found, the result contains one change at the start
     /// of the document.
+    ///
+    /// Instruments created by @ref Document::createInstrumentMap return the timeline it calculated, and copies
+    /// of them share it. The timeline reflects #staves as they were when the map was created. Otherwise the
+    /// changes are calculated on every call.
     InstrumentChangeEvents getChanges() const;
 
     /// @brief Returns the unique instrument identities in order of first appearance.
     std::vector<InstrumentIdentity> getInstrumentIdentities() const;
 
     /// @brief Returns the instrument identity in effect at the specified music point.
+    ///
+    /// This is a binary search of the change positions calculated by @ref Document::createInstrumentMap.
     /// @throws std::logic_error if no identity is in effect at @p point.
     InstrumentIdentity getInstrumentIdentityAt(MusicPoint point) const;
+
+private:
+    /// @brief Immutable instrument-change timeline calculated once per instrument.
+    struct ChangeTimeline
+    {
+        InstrumentChangeEvents changes;                 ///< The effective states keyed by start location.
+        std::vector<MusicPoint> positions;              ///< The keys of #changes in ascending order.
+        std::vector<size_t> identityIndices;            ///< For each position, the index of its identity in #identities.
+        std::vector<InstrumentIdentity> identities;     ///< Unique identities in order of first appearance.
+    };
+
+    /// @brief Calculates the change timeline from the staff style assignments of #staves.
+    std::shared_ptr<const ChangeTimeline> calcChangeTimeline() const;
+
+    /// @brief Calculates the effective instrument states from the staff style assignments of #staves.
+    InstrumentChangeEvents calcChanges() const;
+
+    std::shared_ptr<const ChangeTimeline> m_changeTimeline; ///< Set by @ref Document::createInstrumentMap.
+
+    friend class Document;
 };
 
 /// @brief A list of instruments, which may be single- or multi-staff.
@@ -184,9 +218,21 @@ public:
     using std::unordered_map<StaffCmper, InstrumentInfo>::at;
 
     /// @brief Get the instrument info for the given staffId in the given map
+    ///
+    /// This uses the staff index built by #calcStaffIndex, so the index must be current. A staff that is not in
+    /// the index has no instrument.
     /// @param staffId The staffId to find.
     /// @return The InstrumentInfo for the @p staffId or null if not found.
     const InstrumentInfo* getInstrumentForStaff(StaffCmper staffId) const;
+
+    /// @brief Rebuilds the reverse index from each staff to the top staff of its instrument.
+    ///
+    /// @ref Document::createInstrumentMap calls this when it finishes. Call it again after adding or removing
+    /// instruments or changing their staves.
+    void calcStaffIndex();
+
+private:
+    std::unordered_map<StaffCmper, StaffCmper> m_instrumentByStaff; ///< Maps every mapped staff to the key of its instrument.
 };
 
 } // namespace dom
@@ -21,17 +21,34 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 
 namespace musx {
 namespace dom {
 
+/// @brief Interned 32-bit identifier of a Finale instrument UUID, as returned by #calcInstrumentId.
+/// @details Every UUID in the instrument catalog behind @ref instrumentFamilyFromUuid has a distinct id (checked at
+/// compile time in Instrument.cpp), so for those UUIDs ids can be compared and hashed in place of the strings.
+/// Other UUIDs can share an id, so compare the strings when an exact match matters.
+using InstrumentId = uint32_t;
+
+/// @brief Calculates the interned id of an instrument UUID, which is the 32-bit FNV-1a hash of its text.
+constexpr InstrumentId calcInstrumentId(std::string_view uuid) noexcept
+{
+    InstrumentId result = 2166136261u;
+    for (const char c : uuid) {
+        result = (result ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return result;
+}
+
 /**
  * @namespace musx::dom::uuid
  * @brief Constants for all supported instruments (identified by UUID) in Finale.
  *
  * Any additions, removals, or renames in this namespace must be synchronized with
- * the instrument family lookup table in Instrument.cpp.
+ * the instrument catalog in Instrument.cpp.
  */
 namespace uuid {
 
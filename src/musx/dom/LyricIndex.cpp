@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/dom/LyricIndex.h"
+
+#include <algorithm>
+
+#include "musx/musx.h"
+
+namespace musx {
+namespace dom {
+
+namespace {
+
+uint64_t makeEndpointKey(Cmper textNumber, EntryNumber entryNumber)
+{
+    return (uint64_t(textNumber) << 32) | uint32_t(entryNumber);
+}
+
+template <typename LyricAssignType>
+void indexLyricAssignments(const DocumentPtr& document, Cmper partId,
+    std::unordered_map<Cmper, std::vector<std::vector<LyricIndex::Assignment>>>& syllables,
+    const std::unordered_map<uint64_t, EntryInfoPtr>& endpoints)
+{
+    for (const auto& assign : document->getDetails()->getArray<LyricAssignType>(partId)) {
+        if (assign->syllable == 0) {
+            continue;
+        }
+        auto& textSyllables = syllables[assign->lyricNumber];
+        const size_t syllableIndex = size_t(assign->syllable) - 1;
+        if (syllableIndex >= textSyllables.size()) {
+            textSyllables.resize(syllableIndex + 1);
+        }
+        LyricIndex::Assignment next{ assign->getEntryNumber(), assign->getInci().value_or(0), {} };
+        if (assign->wext) {
+            if (const auto it = endpoints.find(makeEndpointKey(assign->lyricNumber, next.entryNumber)); it != endpoints.end()) {
+                next.wordExtensionEndpoint = it->second;
+            }
+        }
+        textSyllables[syllableIndex].push_back(std::move(next));
+    }
+}
+
+} // namespace
+
+LyricIndex::LyricIndex(const DocumentPtr& document, Cmper partId)
+{
+    const bool useSmartHyphens = [&]() {
+        if (auto lyricOptions = document->getOptions()->get<options::LyricOptions>()) {
+            return lyricOptions->useSmartHyphens;
+        }
+        return true;
+    }();
+    if (useSmartHyphens) {
+        EntryInfoResolver resolver(document, partId);
+        for (const auto& shape : document->getOthers()->getArray<others::SmartShape>(partId)) {
+            if (shape->shapeType != others::SmartShape::ShapeType::WordExtension || !shape->startLyricType) {
+                continue;
+            }
+            const size_t typeIndex = size_t(*shape->startLyricType);
+            if (typeIndex >= LYRIC_TEXT_TYPE_COUNT || !shape->startTermSeg || !shape->endTermSeg) {
+                continue;
+            }
+            const EntryNumber startEntry = shape->startTermSeg->endPoint->entryNumber;
+            if (!startEntry) {
+                continue;
+            }
+            // the first matching shape wins, as it did when each assignment searched its own entry's shapes
+            auto& endpoints = m_wordExtensionEndpoints[typeIndex];
+            const auto key = makeEndpointKey(shape->startLyricNum, startEntry);
+            if (endpoints.find(key) == endpoints.end()) {
+                endpoints.emplace(key, shape->endTermSeg->endPoint->calcAssociatedEntry(resolver));
+            }
+        }
+    }
+
+    indexLyricAssignments<details::LyricAssignVerse>(document, partId, m_syllables[size_t(LyricTextType::Verse)],
+        m_wordExtensionEndpoints[size_t(LyricTextType::Verse)]);
+    indexLyricAssignments<details::LyricAssignChorus>(document, partId, m_syllables[size_t(LyricTextType::Chorus)],
+        m_wordExtensionEndpoints[size_t(LyricTextType::Chorus)]);
+    indexLyricAssignments<details::LyricAssignSection>(document, partId, m_syllables[size_t(LyricTextType::Section)],
+        m_wordExtensionEndpoints[size_t(LyricTextType::Section)]);
+}
+
+const std::vector<LyricIndex::Assignment>& LyricIndex::getAssignments(LyricTextType lyricType, Cmper textNumber, size_t syllableIndex) const
+{
+    static const std::vector<Assignment> empty;
+    const auto& texts = m_syllables.at(size_t(lyricType));
+    if (const auto it = texts.find(textNumber); it != texts.end() && syllableIndex < it->second.size()) {
+        return it->second[syllableIndex];
+    }
+    return empty;
+}
+
+size_t LyricIndex::getSyllableCount(LyricTextType lyricType, Cmper textNumber) const
+{
+    const auto& texts = m_syllables.at(size_t(lyricType));
+    if (const auto it = texts.find(textNumber); it != texts.end()) {
+        return it->second.size();
+    }
+    return 0;
+}
+
+std::vector<Cmper> LyricIndex::getTextNumbers(LyricTextType lyricType) const
+{
+    std::vector<Cmper> result;
+    for (const auto& [textNumber, syllables] : m_syllables.at(size_t(lyricType))) {
+        result.push_back(textNumber);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+EntryInfoPtr LyricIndex::getWordExtensionEndpoint(LyricTextType lyricType, Cmper textNumber, EntryNumber entryNumber) const
+{
+    const auto& endpoints = m_wordExtensionEndpoints.at(size_t(lyricType));
+    if (const auto it = endpoints.find(makeEndpointKey(textNumber, entryNumber)); it != endpoints.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+} // namespace dom
+} // namespace musx
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Entries.h"
+
+namespace musx {
+namespace dom {
+
+/**
+ * @class LyricIndex
+ * @brief Document-wide index of lyric assignments for a score or linked part.
+ *
+ * For each lyric text block, identified by its @ref LyricTextType and text number, the index maps every
+ * syllable to the entries it is assigned to. Each assignment also carries its precomputed word extension endpoint.
+ * This turns full lyric extraction into a linear scan and makes repeated word extension lookups O(1).
+ *
+ * This is not a Finale data class. Obtain it with @ref Document::getLyricIndex, which builds it on first use.
+ */
+class LyricIndex
+{
+public:
+    /// @brief A single lyric assignment in the index.
+    struct Assignment
+    {
+        EntryNumber entryNumber{};          ///< The entry to which the syllable is assigned.
+        Inci inci{};                        ///< The inci of the @ref details::LyricAssign instance on the entry.
+        EntryInfoPtr wordExtensionEndpoint; ///< The terminating entry of the smart word extension, or null if none.
+    };
+
+    /// @brief Builds the index for a score or linked part.
+    /// @param document The document to index.
+    /// @param partId The score or linked part to index.
+    LyricIndex(const DocumentPtr& document, Cmper partId);
+
+    /// @brief Returns the assignments for a syllable, in entry number order.
+    /// @param lyricType The type of lyrics text block.
+    /// @param textNumber The text number of the lyrics text block.
+    /// @param syllableIndex The 0-based syllable index. (This is one less than @ref details::LyricAssign::syllable.)
+    /// @return The assignments, which are empty if none.
+    [[nodiscard]]
+    const std::vector<Assignment>& getAssignments(LyricTextType lyricType, Cmper textNumber, size_t syllableIndex) const;
+
+    /// @brief Returns the number of syllables that have entries in the index for a text block. This is one more
+    /// than the highest assigned syllable index, so it may be less than the number of syllables in the text.
+    [[nodiscard]]
+    size_t getSyllableCount(LyricTextType lyricType, Cmper textNumber) const;
+
+    /// @brief Returns the text numbers with at least one assignment, in ascending order.
+    [[nodiscard]]
+    std::vector<Cmper> getTextNumbers(LyricTextType lyricType) const;
+
+    /// @brief Returns the precomputed word extension endpoint for a lyric assignment.
+    /// @param lyricType The type of lyrics text block.
+    /// @param textNumber The text number of the lyrics text block.
+    /// @param entryNumber The entry the syllable is assigned to.
+    /// @return The terminating entry of the smart word extension, or null if none.
+    [[nodiscard]]
+    EntryInfoPtr getWordExtensionEndpoint(LyricTextType lyricType, Cmper textNumber, EntryNumber entryNumber) const;
+
+private:
+    static constexpr size_t LYRIC_TEXT_TYPE_COUNT = 3;
+
+    using SyllableAssignments = std::vector<std::vector<Assignment>>; ///< indexed by 0-based syllable index
+
+    std::array<std::unordered_map<Cmper, SyllableAssignments>, LYRIC_TEXT_TYPE_COUNT> m_syllables;
+    std::array<std::unordered_map<uint64_t, EntryInfoPtr>, LYRIC_TEXT_TYPE_COUNT> m_wordExtensionEndpoints; ///< keyed by text number and start entry
+};
+
+} // namespace dom
+} // namespace musx
@@ -753,9 +753,62 @@ public:
         return it->second;
     }
 
+    /// @brief Clears the location of every entry and discards the frame table. (Called by #Entry::calcLocations.)
+    void clearLocations();
+
+    /// @brief Sets the location of each entry in a frame. (Called by #Entry::calcLocations.)
+    ///
+    /// Once the frame table has been built (see #buildFrameEntries), this also records the frame's entries, and
+    /// entries previously recorded for the frame that are no longer in it have their location cleared.
+    /// @param gfhold The frame to locate.
+    void locateFrameEntries(const details::GFrameHold& gfhold);
+
+    /// @brief Clears the location of every entry recorded for a frame and discards the record. (Called by #Entry::calcLocations
+    /// for frames that no longer have a @ref details::GFrameHold.)
+    /// @param staffId The staff of the frame.
+    /// @param measureId The measure of the frame.
+    void clearFrameEntries(StaffCmper staffId, MeasCmper measureId);
+
+    /// @brief Builds the frame table from the current entry locations, if it has not been built yet.
+    ///
+    /// Only scoped refreshes need the table, so it is built by the first of them rather than when the document is loaded.
+    void buildFrameEntries();
+
+    /// @brief Returns the entries that were last located in a frame, in layer and then entry order.
+    ///
+    /// This is always empty until #buildFrameEntries has been called.
+    /// @param staffId The staff of the frame.
+    /// @param measureId The measure of the frame.
+    const std::vector<EntryNumber>& getFrameEntries(StaffCmper staffId, MeasCmper measureId) const;
+
+    /// @brief Lays out every entry contiguously in frame traversal order. (Called by #Entry::calcLocations.)
+    ///
+    /// Entries with a location are ordered by staff, measure, layer, and index within the layer, so each frame's entries
+    /// occupy adjacent slots. Entries without a location follow in entry list order.
+    void buildArena();
+
+    /// @brief Iterates raw entries starting at @p firstEntry and following the entry list through @p lastEntry.
+    ///
+    /// Adjacent arena slots are used as long as they match the entry list. Otherwise the entry list is followed directly.
+    /// @param firstEntry The first entry to iterate.
+    /// @param lastEntry The entry number at which iteration stops (inclusive). Iteration also stops at the end of the list.
+    /// @param iterator The callback function. Return false to stop iterating.
+    /// @return true if all entries iterated, false if the iterator function exited early by returning false.
+    bool iterateEntries(const MusxInstance<Entry>& firstEntry, EntryNumber lastEntry,
+        const std::function<bool(const MusxInstance<Entry>&)>& iterator) const;
+
+    /// @brief Returns the entry that follows @p entry in the entry list, using the arena when possible.
+    MusxInstance<Entry> getNext(const Entry& entry) const;
+
 private:
+    /// @brief Returns the arena slot of @p entry, or std::nullopt if it is not in the arena.
+    std::optional<size_t> findArenaSlot(const Entry& entry) const;
+
     DocumentWeakPtr m_document;
     std::unordered_map<EntryNumber, std::shared_ptr<Entry>> m_pool;
+    std::vector<MusxInstance<Entry>> m_arena;   ///< All entries in frame traversal order. Empty until #buildArena is called.
+    std::map<std::pair<StaffCmper, MeasCmper>, std::vector<EntryNumber>> m_frameEntries; ///< Entries located in each frame by #locateFrameEntries.
+    bool m_frameEntriesBuilt{};                 ///< Set by #buildFrameEntries and reset by #clearLocations.
 
     friend class bench::PoolAccessor<EntryPool>;
 };
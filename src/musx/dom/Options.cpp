@@ -38,7 +38,7 @@ namespace options {
 bool ClefOptions::ClefDef::isBlank() const
 {
     if (isShape) {
-        if (const auto shape = shapeId ? getDocument()->getOthers()->get<others::ShapeDef>(SCORE_PARTID, shapeId) : nullptr) {
+        if (const auto shape = shapeId ? getDocumentRef().getOthers()->get<others::ShapeDef>(SCORE_PARTID, shapeId) : nullptr) {
             return shape->isBlank();
         }
         return true;
@@ -67,7 +67,7 @@ ClefOptions::ClefInfo ClefOptions::ClefDef::calcInfo(const MusxInstance<others::
     auto calcTabType = [&]() -> music_theory::ClefType {
         music_theory::ClefType result = music_theory::ClefType::Tab;
         if (isShape) {
-            if (auto shape = getDocument()->getOthers()->get<others::ShapeDef>(SCORE_PARTID, shapeId)) {
+            if (auto shape = getDocumentRef().getOthers()->get<others::ShapeDef>(SCORE_PARTID, shapeId)) {
                 shape->iterateInstructions([&](const ShapeDefInstruction::Decoded& inst) -> bool {
                     if (inst.type == ShapeDefInstructionType::SetFont) {
                         auto setFont = std::get<ShapeDefInstruction::SetFont>(inst.data);
@@ -120,7 +120,7 @@ MusxInstance<FontInfo> ClefOptions::ClefDef::calcFont() const
     MusxInstance<FontInfo> result;
     if (useOwnFont && font) {
         result = font;
-    } else if (auto fontOptions = getDocument()->getOptions()->get<FontOptions>()) {
+    } else if (auto fontOptions = getDocumentRef().getOptions()->get<FontOptions>()) {
         result = fontOptions->getFontInfo(FontOptions::FontType::Clef);
     }
     if (!result) {
@@ -176,7 +176,7 @@ MusxInstance<PageFormatOptions::PageFormat> PageFormatOptions::calcPageFormatFor
 {
     const auto& baseOptions = (partId == SCORE_PARTID) ? pageFormatScore : pageFormatParts;
     auto retval = std::make_shared<PageFormatOptions::PageFormat>(*baseOptions);
-    auto pages = getDocument()->getOthers()->getArray<others::Page>(partId);
+    auto pages = getDocumentRef().getOthers()->getArray<others::Page>(partId);
     auto page1 = pages.size() >= 1 ? pages[0] : nullptr;
     auto page2 = pages.size() >= 2 ? pages[1] : page1; // left page
     auto page3 = pages.size() >= 3 ? pages[2] : page1; // right page that isn't page 1
@@ -205,7 +205,7 @@ MusxInstance<PageFormatOptions::PageFormat> PageFormatOptions::calcPageFormatFor
             retval->rightPageMarginRight = page3->margRight;
         }
     }
-    auto systems = getDocument()->getOthers()->getArray<others::StaffSystem>(partId);
+    auto systems = getDocumentRef().getOthers()->getArray<others::StaffSystem>(partId);
     auto system1 = systems.size() >= 1 ? systems[0] : nullptr;
     auto system2 = systems.size() >= 2 ? systems[1] : system1;
     if (system2) {
@@ -116,16 +116,10 @@ ArticulationDef::SelectedSymbol ArticulationDef::calcSelectedSymbol(bool placeAb
 bool Frame::iterateRawEntries(std::function<bool(const MusxInstance<Entry>& entry)> iterator) const
 {
     bool result = true;
-    auto firstEntry = startEntry ? getDocument()->getEntries()->get(startEntry) : nullptr;
+    const auto entries = getDocumentRef().getEntries();
+    auto firstEntry = startEntry ? entries->get(startEntry) : nullptr;
     if (firstEntry) {
-        for (auto entry = firstEntry; entry; entry = entry->getNext()) {
-            if (!iterator(entry)) {
-                return false;
-            }
-            if (entry->getEntryNumber() == endEntry) {
-                return true;
-            }
-        }
+        return entries->iterateEntries(firstEntry, endEntry, iterator);
     } else {
         result = false;
         MUSX_INTEGRITY_ERROR("Frame " + std::to_string(getCmper()) + " inci " + std::to_string(getInci().value_or(-1)) + " is not iterable.");
@@ -149,7 +143,7 @@ MusxInstanceList<Entry> Frame::getEntries() const
 
 MusxInstance<FretInstrument> FretboardGroup::getFretInstrument() const
 {
-    return getDocument()->getOthers()->get<FretInstrument>(getRequestedPartId(), fretInstId);
+    return getDocumentRef().getOthers()->get<FretInstrument>(getRequestedPartId(), fretInstId);
 }
 
 MusxInstanceList<details::FretboardDiagram> FretboardGroup::getFretboardDiagrams() const
@@ -160,7 +154,7 @@ MusxInstanceList<details::FretboardDiagram> FretboardGroup::getFretboardDiagrams
     }
     Cmper cmper2Base = Cmper(getInci().value()) * 16;
     for (Cmper cmper2Offset = 0; cmper2Offset < music_theory::STANDARD_12EDO_STEPS; cmper2Offset++) {
-        if (auto nextDiagram = getDocument()->getDetails()->get<details::FretboardDiagram>(getRequestedPartId(), getCmper(), cmper2Base + cmper2Offset)) {
+        if (auto nextDiagram = getDocumentRef().getDetails()->get<details::FretboardDiagram>(getRequestedPartId(), getCmper(), cmper2Base + cmper2Offset)) {
             result.push_back(nextDiagram);
         } else {
             result.clear();
@@ -180,7 +174,7 @@ MusxInstanceList<details::FretboardDiagram> FretboardGroup::getFretboardDiagrams
 
 std::string MarkingCategory::getName() const
 {
-    auto catName = getDocument()->getOthers()->get<MarkingCategoryName>(getRequestedPartId(), getCmper());
+    auto catName = getDocumentRef().getOthers()->get<MarkingCategoryName>(getRequestedPartId(), getCmper());
     if (catName) {
         return catName->name;
     }
@@ -210,7 +204,7 @@ void Measure::checkMeasureCmperSequence(const DocumentPtr& document)
 
 MusxInstance<MeasureNumberRegion> Measure::findMeasureNumberRegion() const
 {
-    auto regions = getDocument()->getOthers()->getArray<MeasureNumberRegion>(getRequestedPartId());
+    auto regions = getDocumentRef().getOthers()->getArray<MeasureNumberRegion>(getRequestedPartId());
 
     MusxInstance<MeasureNumberRegion> fallback;
 
@@ -260,7 +254,7 @@ MusxInstance<KeySignature> Measure::createKeySignature(const std::optional<Staff
     if (forStaff) {
         staff = StaffComposite::createCurrent(getDocument(), getRequestedPartId(), forStaff.value(), getCmper(), 0);
         if (staff && staff->floatKeys) {
-            if (auto floats = getDocument()->getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
+            if (auto floats = getDocumentRef().getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
                 if (floats->hasKey) {
                     result = std::make_shared<KeySignature>(*floats->keySig);
                 }
@@ -281,7 +275,7 @@ MusxInstance<TimeSignature> Measure::createTimeSignature(const std::optional<Sta
     if (forStaff) {
         if (auto staff = StaffComposite::createCurrent(getDocument(), getRequestedPartId(), forStaff.value(), getCmper(), 0)) {
             if (staff->floatTime) {
-                if (auto floats = getDocument()->getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
+                if (auto floats = getDocumentRef().getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
                     if (floats->hasTime) {
                         return floats->createTimeSignature();
                     }
@@ -297,7 +291,7 @@ MusxInstance<TimeSignature> Measure::createDisplayTimeSignature(const std::optio
     if (forStaff) {
         if (auto staff = StaffComposite::createCurrent(getDocument(), getRequestedPartId(), forStaff.value(), getCmper(), 0)) {
             if (staff->floatTime) {
-                if (auto floats = getDocument()->getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
+                if (auto floats = getDocumentRef().getDetails()->get<details::IndependentStaffDetails>(getRequestedPartId(), forStaff.value(), getCmper())) {
                     if (floats->hasTime) {
                         return floats->createDisplayTimeSignature();
                     }
@@ -329,7 +323,7 @@ util::Fraction Measure::calcMinLegacyPickupSpacer(StaffCmper forStaffId) const
 std::optional<Duration> Measure::calcDefaultPickupRestValue() const
 {
     if (getCmper() == 1) { // only check first measure for a pickup: this is observed Finale behavior
-        if (const auto miscOptions = getDocument()->getOptions()->get<options::MiscOptions>()) {
+        if (const auto miscOptions = getDocumentRef().getOptions()->get<options::MiscOptions>()) {
             if (miscOptions->pickupValue > 0) {
                 // It may be necessary to check STUDIO_VIEW_SCROLL_VIEW_ID to see if it has a pickup spacer,
                 // but for now we trust MiscOptions.
@@ -397,7 +391,7 @@ MusxInstance<TextExpressionDef> MeasureExprAssign::getTextExpression() const
     if (!textExprId) {
         return nullptr;
     }
-    return getDocument()->getOthers()->get<TextExpressionDef>(getRequestedPartId(), textExprId);
+    return getDocumentRef().getOthers()->get<TextExpressionDef>(getRequestedPartId(), textExprId);
 }
 
 MusxInstance<ShapeExpressionDef> MeasureExprAssign::getShapeExpression() const
@@ -405,7 +399,7 @@ MusxInstance<ShapeExpressionDef> MeasureExprAssign::getShapeExpression() const
     if (!shapeExprId) {
         return nullptr;
     }
-    return getDocument()->getOthers()->get<ShapeExpressionDef>(getRequestedPartId(), shapeExprId);
+    return getDocumentRef().getOthers()->get<ShapeExpressionDef>(getRequestedPartId(), shapeExprId);
 }
 
 MusxInstance<MarkingCategory> MeasureExprAssign::getMarkingCategory() const
@@ -419,7 +413,7 @@ MusxInstance<MarkingCategory> MeasureExprAssign::getMarkingCategory() const
     if (!categoryId) {
         return nullptr;
     }
-    return getDocument()->getOthers()->get<MarkingCategory>(getRequestedPartId(), categoryId);
+    return getDocumentRef().getOthers()->get<MarkingCategory>(getRequestedPartId(), categoryId);
 }
 
 CategoryStaffListSet MeasureExprAssign::createStaffListSet() const
@@ -499,9 +493,9 @@ EntryInfoPtr MeasureExprAssign::calcAssociatedEntry() const
             if (graceIndex > 0) {
                 if (const auto mainEntry = gfHold.calcNearestEntry(position, findExact, matchLayer, matchVoice)) {
                     util::Logger::log(util::Logger::LogLevel::Info,
-                        "Dangling graceNoteIndex " + std::to_string(this->graceNoteIndex) +
+                        [&]() { return "Dangling graceNoteIndex " + std::to_string(this->graceNoteIndex) +
                         " on expression assignment in measure " + std::to_string(getCmper()) +
-                        ". Falling back to the main entry.");
+                        ". Falling back to the main entry."; });
                     return mainEntry;
                 }
             }
@@ -530,14 +524,14 @@ StaffCmper MeasureExprAssign::calcAssignedStaffId(bool forPageView) const
     }
     const auto systemStaves = [&]() -> std::optional<MusxInstanceList<StaffUsed>> {
         if (forPageView) {
-            const auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
+            const auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
             if (part && part->isLayoutCalculated()) {
-                if (auto system = getDocument()->calcSystemFromMeasure(getRequestedPartId(), getCmper())) {
-                    return getDocument()->getOthers()->getArray<StaffUsed>(getRequestedPartId(), system->getCmper());
+                if (auto system = getDocumentRef().calcSystemFromMeasure(getRequestedPartId(), getCmper())) {
+                    return getDocumentRef().getOthers()->getArray<StaffUsed>(getRequestedPartId(), system->getCmper());
                 }
             }
         }
-        return getDocument()->getScrollViewStaves(getRequestedPartId());
+        return getDocumentRef().getScrollViewStaves(getRequestedPartId());
     }();
     switch (static_cast<StaffList::FloatingValues>(staffAssign)) {
         case StaffList::FloatingValues::TopStaff: return systemStaves->getTopStaffId();
@@ -572,11 +566,11 @@ std::optional<Evpu> MeasureExprAssign::calcBaselinePosition(bool forAbove) const
 {
     std::optional<Evpu> result = std::nullopt;
     constexpr bool forPageView = true;
-    const auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
+    const auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
     if (!part || !part->isLayoutCalculated()) {
         return result;
     }
-    if (const auto sys = getDocument()->calcSystemFromMeasure(getRequestedPartId(), getCmper())) {
+    if (const auto sys = getDocumentRef().calcSystemFromMeasure(getRequestedPartId(), getCmper())) {
         const StaffCmper assignedStaffId = calcAssignedStaffId(forPageView);
         if (const auto systemStaff = StaffComposite::createCurrent(getDocument(), getRequestedPartId(), assignedStaffId, sys->startMeas, 0)) {
             result = forAbove
@@ -877,7 +871,7 @@ std::optional<int> MeasureNumberRegion::calcDisplayNumberFor(MeasCmper measureId
     }
     int result = int(measureId) - int(startMeas) + getStartNumber();
     for (MeasCmper nextMeasId = startMeas; nextMeasId <= measureId; nextMeasId++) {
-        if (auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), nextMeasId)) {
+        if (auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), nextMeasId)) {
             if (measure->noMeasNum) {
                 if (measure->getCmper() == measureId) {
                     return std::nullopt;
@@ -901,7 +895,7 @@ std::optional<std::string> MeasureNumberRegion::calcDisplayNumberTextFor(MeasCmp
 std::optional<MeasCmper> MeasureNumberRegion::calcFirstDisplayedMeasureId() const
 {
     for (MeasCmper startMeasId = startMeas; startMeasId < endMeas; startMeasId++) {
-        if (auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), startMeasId)) {
+        if (auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), startMeasId)) {
             if (!measure->noMeasNum) {
                 return startMeasId;
             }
@@ -915,7 +909,7 @@ std::optional<MeasCmper> MeasureNumberRegion::calcFirstDisplayedMeasureId() cons
 std::optional<MeasCmper> MeasureNumberRegion::calcLastDisplayedMeasureId() const
 {
     for (MeasCmper endMeasId = endMeas - 1; endMeasId >= startMeas; endMeasId--) {
-        if (auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), endMeasId)) {
+        if (auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), endMeasId)) {
             if (!measure->noMeasNum) {
                 return endMeasId;
             }
@@ -958,7 +952,7 @@ bool MultimeasureRest::calcUsesSymbols() const
 MusxInstance<Staff> MultiStaffInstrumentGroup::getStaffInstanceAtIndex(size_t x) const
 {
     if (x >= staffNums.size()) return nullptr;
-    auto retval = getDocument()->getOthers()->get<Staff>(getRequestedPartId(), staffNums[x]);
+    auto retval = getDocumentRef().getOthers()->get<Staff>(getRequestedPartId(), staffNums[x]);
     if (!retval) {
         MUSX_INTEGRITY_ERROR("Staff " + std::to_string(staffNums[x])
             + " not found for multiple staff instrument " + std::to_string(getCmper()));
@@ -1003,8 +997,8 @@ void MultiStaffInstrumentGroup::calcAllMultiStaffGroupIds(const DocumentPtr& doc
                 if (staff->multiStaffInstId != instance->getCmper()) {
                     if (staff->multiStaffInstId) {
                         musx::util::Logger::log(musx::util::Logger::LogLevel::Verbose,
-                            "Staff " + std::to_string(staff->getCmper()) + " (" + staff->getFullName()
-                                + ") appears in more than one instance of MultiStaffInstrumentGroup.");
+                            [&]() { return "Staff " + std::to_string(staff->getCmper()) + " (" + staff->getFullName()
+                                + ") appears in more than one instance of MultiStaffInstrumentGroup."; });
                     } else {
                         Staff* staffMutable = const_cast<Staff*>(staff.get());
                         staffMutable->multiStaffInstId = instance->getCmper();
@@ -1023,110 +1017,118 @@ void MultiStaffInstrumentGroup::calcAllMultiStaffGroupIds(const DocumentPtr& doc
 
 void Page::calcSystemInfo(const DocumentPtr& document)
 {
-    auto linkedParts = document->getOthers()->getArray<PartDefinition>(SCORE_PARTID);
-    for (const auto& part : linkedParts) {
-        auto pages = document->getOthers()->getArray<Page>(part->getCmper());
-        auto systems = document->getOthers()->getArray<StaffSystem>(part->getCmper());
-        const auto reportStructuralLayoutProblem = [&](const std::string& message) {
-            if (part->isScore()) {
-                MUSX_INTEGRITY_ERROR(message);
-            } else {
-                util::Logger::log(util::Logger::LogLevel::Verbose, message);
-            }
-        };
-        const auto reportUncalculatedLayout = [&](const std::string& message) {
-            // Finale can save an uncalculated layout for any part, though it is much more common
-            // for linked parts. This state is informational for the score and verbose for parts.
-            util::Logger::log(part->isScore() ? util::Logger::LogLevel::Info : util::Logger::LogLevel::Verbose, message);
-        };
-        for (const auto& system : systems) {
-            StaffSystem* mutableSystem = const_cast<StaffSystem*>(system.get());
-            mutableSystem->pageId = 0; // initialize
-        }
-        for (size_t x = 0; x < pages.size(); x++) {
-            auto page = pages[x];
-            Page* mutablePage = const_cast<Page*>(page.get());
-            mutablePage->lastSystemId = std::nullopt;
-            mutablePage->firstMeasureId = std::nullopt;
-            mutablePage->lastMeasureId = std::nullopt;
-            if (page->isBlank()) {
-                continue;
-            }
-            if (page->firstSystemId <= 0) {
-                reportUncalculatedLayout("Layout for page " + std::to_string(page->getCmper())
-                    + " of part " + std::to_string(part->getCmper()) + " has not been calculated.");
-                continue;
-            }
+    for (const auto& part : document->getOthers()->getArray<PartDefinition>(SCORE_PARTID)) {
+        calcSystemInfo(document, part->getCmper());
+    }
+}
 
-            std::optional<SystemCmper> lastSystemId;
-            bool foundFollowingNonBlankPage = false;
-            size_t nextIndex = x + 1;
-            while (nextIndex < pages.size()) {
-                const auto& nextPage = pages[nextIndex++];
-                if (!nextPage->isBlank()) {
-                    foundFollowingNonBlankPage = true;
-                    if (nextPage->firstSystemId > 0) {
-                        lastSystemId = SystemCmper(nextPage->firstSystemId - 1);
-                    }
-                    break;
-                }
-            }
-            if (!lastSystemId && !foundFollowingNonBlankPage) {
-                if (!systems.empty()) {
-                    lastSystemId = systems.back()->getCmper();
+void Page::calcSystemInfo(const DocumentPtr& document, Cmper partId)
+{
+    const auto part = document->getOthers()->get<PartDefinition>(SCORE_PARTID, partId);
+    if (!part) {
+        return;
+    }
+    auto pages = document->getOthers()->getArray<Page>(part->getCmper());
+    auto systems = document->getOthers()->getArray<StaffSystem>(part->getCmper());
+    const auto reportStructuralLayoutProblem = [&](const std::string& message) {
+        if (part->isScore()) {
+            MUSX_INTEGRITY_ERROR(message);
+        } else {
+            util::Logger::log(util::Logger::LogLevel::Verbose, message);
+        }
+    };
+    const auto reportUncalculatedLayout = [&](const std::string& message) {
+        // Finale can save an uncalculated layout for any part, though it is much more common
+        // for linked parts. This state is informational for the score and verbose for parts.
+        util::Logger::log(part->isScore() ? util::Logger::LogLevel::Info : util::Logger::LogLevel::Verbose, message);
+    };
+    for (const auto& system : systems) {
+        StaffSystem* mutableSystem = const_cast<StaffSystem*>(system.get());
+        mutableSystem->pageId = 0; // initialize
+    }
+    for (size_t x = 0; x < pages.size(); x++) {
+        auto page = pages[x];
+        Page* mutablePage = const_cast<Page*>(page.get());
+        mutablePage->lastSystemId = std::nullopt;
+        mutablePage->firstMeasureId = std::nullopt;
+        mutablePage->lastMeasureId = std::nullopt;
+        if (page->isBlank()) {
+            continue;
+        }
+        if (page->firstSystemId <= 0) {
+            reportUncalculatedLayout("Layout for page " + std::to_string(page->getCmper())
+                + " of part " + std::to_string(part->getCmper()) + " has not been calculated.");
+            continue;
+        }
+
+        std::optional<SystemCmper> lastSystemId;
+        bool foundFollowingNonBlankPage = false;
+        size_t nextIndex = x + 1;
+        while (nextIndex < pages.size()) {
+            const auto& nextPage = pages[nextIndex++];
+            if (!nextPage->isBlank()) {
+                foundFollowingNonBlankPage = true;
+                if (nextPage->firstSystemId > 0) {
+                    lastSystemId = SystemCmper(nextPage->firstSystemId - 1);
                 }
+                break;
             }
-            if (!lastSystemId) {
-                const auto message = "The systems on page " + std::to_string(page->getCmper()) + " of part " + part->getName()
-                    + " cannot be determined.";
-                if (foundFollowingNonBlankPage) {
-                    reportUncalculatedLayout(message);
-                } else {
-                    reportStructuralLayoutProblem(message);
-                }
-                continue;
+        }
+        if (!lastSystemId && !foundFollowingNonBlankPage) {
+            if (!systems.empty()) {
+                lastSystemId = systems.back()->getCmper();
             }
-            if (lastSystemId.value() < page->firstSystemId) {
-                reportStructuralLayoutProblem("The systems on page " + std::to_string(page->getCmper()) + " of part " + part->getName()
-                    + " cannot be determined.");
-                continue;
+        }
+        if (!lastSystemId) {
+            const auto message = "The systems on page " + std::to_string(page->getCmper()) + " of part " + part->getName()
+                + " cannot be determined.";
+            if (foundFollowingNonBlankPage) {
+                reportUncalculatedLayout(message);
+            } else {
+                reportStructuralLayoutProblem(message);
             }
+            continue;
+        }
+        if (lastSystemId.value() < page->firstSystemId) {
+            reportStructuralLayoutProblem("The systems on page " + std::to_string(page->getCmper()) + " of part " + part->getName()
+                + " cannot be determined.");
+            continue;
+        }
 
-            std::vector<MusxInstance<StaffSystem>> pageSystems;
-            bool hasInvalidSystem = false;
-            for (SystemCmper systemId = page->firstSystemId; systemId <= lastSystemId.value(); ++systemId) {
-                auto system = document->getOthers()->get<StaffSystem>(part->getCmper(), systemId);
-                if (!system) {
-                    reportStructuralLayoutProblem("Page " + std::to_string(page->getCmper()) + " of part " + part->getName()
-                        + " has no system instance for system " + std::to_string(systemId) + ".");
-                    hasInvalidSystem = true;
-                    break;
-                }
-                if (system->startMeas == 0 || system->endMeas == 0) {
-                    reportUncalculatedLayout("Layout for system " + std::to_string(systemId) + " of part "
-                        + std::to_string(part->getCmper()) + " has not been calculated.");
-                    hasInvalidSystem = true;
-                    break;
-                }
-                if (system->endMeas <= system->startMeas) {
-                    reportStructuralLayoutProblem("Page " + std::to_string(page->getCmper()) + " of part " + part->getName()
-                        + " has an invalid measure range for system " + std::to_string(systemId) + ".");
-                    hasInvalidSystem = true;
-                    break;
-                }
-                pageSystems.emplace_back(std::move(system));
+        std::vector<MusxInstance<StaffSystem>> pageSystems;
+        bool hasInvalidSystem = false;
+        for (SystemCmper systemId = page->firstSystemId; systemId <= lastSystemId.value(); ++systemId) {
+            auto system = document->getOthers()->get<StaffSystem>(part->getCmper(), systemId);
+            if (!system) {
+                reportStructuralLayoutProblem("Page " + std::to_string(page->getCmper()) + " of part " + part->getName()
+                    + " has no system instance for system " + std::to_string(systemId) + ".");
+                hasInvalidSystem = true;
+                break;
             }
-            if (hasInvalidSystem) {
-                continue;
+            if (system->startMeas == 0 || system->endMeas == 0) {
+                reportUncalculatedLayout("Layout for system " + std::to_string(systemId) + " of part "
+                    + std::to_string(part->getCmper()) + " has not been calculated.");
+                hasInvalidSystem = true;
+                break;
             }
-
-            mutablePage->lastSystemId = lastSystemId;
-            mutablePage->firstMeasureId = pageSystems.front()->startMeas;
-            mutablePage->lastMeasureId = pageSystems.back()->getLastMeasure();
-            for (const auto& system : pageSystems) {
-                StaffSystem* mutableSystem = const_cast<StaffSystem*>(system.get());
-                mutableSystem->pageId = PageCmper(page->getCmper());
+            if (system->endMeas <= system->startMeas) {
+                reportStructuralLayoutProblem("Page " + std::to_string(page->getCmper()) + " of part " + part->getName()
+                    + " has an invalid measure range for system " + std::to_string(systemId) + ".");
+                hasInvalidSystem = true;
+                break;
             }
+            pageSystems.emplace_back(std::move(system));
+        }
+        if (hasInvalidSystem) {
+            continue;
+        }
+
+        mutablePage->lastSystemId = lastSystemId;
+        mutablePage->firstMeasureId = pageSystems.front()->startMeas;
+        mutablePage->lastMeasureId = pageSystems.back()->getLastMeasure();
+        for (const auto& system : pageSystems) {
+            StaffSystem* mutableSystem = const_cast<StaffSystem*>(system.get());
+            mutableSystem->pageId = PageCmper(page->getCmper());
         }
     }
 }
@@ -1137,7 +1139,7 @@ void Page::calcSystemInfo(const DocumentPtr& document)
 
 MusxInstance<TextBlock> PageTextAssign::getTextBlock() const
 {
-    return getDocument()->getOthers()->get<TextBlock>(getRequestedPartId(), block);
+    return getDocumentRef().getOthers()->get<TextBlock>(getRequestedPartId(), block);
 }
 
 util::EnigmaParsingContext PageTextAssign::getRawTextCtx(Cmper forPartId, std::optional<Cmper> forPageId) const
@@ -1171,7 +1173,7 @@ MusxInstanceList<PageTextAssign> PageTextAssign::getArrayForPageId(const Documen
 
 std::optional<PageCmper> PageTextAssign::calcStartPageNumber(Cmper forPartId) const
 {
-    if (auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
+    if (auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
         if (auto calcValue = part->calcPageNumberFromAssignmentId(getCmper() ? getCmper() : startPage)) {
             if (calcValue.value() <= part->numberOfPages) {
                 return calcValue;
@@ -1189,7 +1191,7 @@ std::optional<PageCmper> PageTextAssign::calcStartPageNumber(Cmper forPartId) co
 
 std::optional<PageCmper> PageTextAssign::calcEndPageNumber(Cmper forPartId) const
 {
-    if (auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
+    if (auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, forPartId)) {
         if (isMultiAssignedThruLastPage()) {
             return PageCmper(part->numberOfPages);
         }
@@ -1211,7 +1213,7 @@ util::EnigmaParsingContext PartDefinition::getNameRawTextCtx() const
 {
     /// @todo perhaps additional logic as in getName, but not until something is broken.
     if (nameId) {
-        if (auto textBlock = getDocument()->getOthers()->get<TextBlock>(getRequestedPartId(), nameId)) {
+        if (auto textBlock = getDocumentRef().getOthers()->get<TextBlock>(getRequestedPartId(), nameId)) {
             return textBlock->getRawTextCtx(getCmper());
         }
     }
@@ -1226,14 +1228,14 @@ std::string PartDefinition::getName(util::EnigmaString::AccidentalStyle accident
         return nameRawText.getText(true, accidentalStyle, ignoreTags);
     }
     if (defaultNameStaff) {
-        if (auto staff = getDocument()->getOthers()->get<Staff>(SCORE_PARTID, defaultNameStaff)) {
+        if (auto staff = getDocumentRef().getOthers()->get<Staff>(SCORE_PARTID, defaultNameStaff)) {
             return staff->getFullInstrumentName(accidentalStyle, true); // true: prefer staff name
         } else {
             MUSX_INTEGRITY_ERROR("Part " + std::to_string(getCmper()) + " uses nonexistent Staff " + std::to_string(defaultNameStaff) + " for part name.");
         }
     }
     if (defaultNameGroup) {
-        if (auto group = getDocument()->getDetails()->get<details::StaffGroup>(SCORE_PARTID, getDocument()->calcScrollViewCmper(SCORE_PARTID), defaultNameGroup)) {
+        if (auto group = getDocumentRef().getDetails()->get<details::StaffGroup>(SCORE_PARTID, getDocumentRef().calcScrollViewCmper(SCORE_PARTID), defaultNameGroup)) {
             return group->getFullInstrumentName(accidentalStyle);
         } else {
             MUSX_INTEGRITY_ERROR("Part " + std::to_string(getCmper()) + " uses nonexistent StaffGroup " + std::to_string(defaultNameGroup) + " for part name.");
@@ -1244,7 +1246,7 @@ std::string PartDefinition::getName(util::EnigmaString::AccidentalStyle accident
 
 bool PartDefinition::isLayoutCalculated() const
 {
-    const auto pages = getDocument()->getOthers()->getArray<Page>(getCmper());
+    const auto pages = getDocumentRef().getOthers()->getArray<Page>(getCmper());
     return !pages.empty() && std::all_of(pages.begin(), pages.end(), [](const auto& page) {
         return page->isLayoutCalculated();
     });
@@ -1272,7 +1274,7 @@ MusxInstanceList<PartDefinition> PartDefinition::getInUserOrder(const DocumentPt
 
 Cmper PartDefinition::calcScrollViewCmper() const
 {
-    return getDocument()->calcScrollViewCmper(getCmper());
+    return getDocumentRef().calcScrollViewCmper(getCmper());
 }
 
 std::optional<PageCmper> PartDefinition::calcPageNumberFromAssignmentId(PageCmper pageAssignmentId) const
@@ -1282,7 +1284,7 @@ std::optional<PageCmper> PartDefinition::calcPageNumberFromAssignmentId(PageCmpe
     }
     std::optional<PageCmper> result = pageAssignmentId;
     if (result.value() > numberOfLeadingBlankPages) {
-        const int calcValue = int(result.value()) - getDocument()->getMaxBlankPages() + numberOfLeadingBlankPages;
+        const int calcValue = int(result.value()) - getDocumentRef().getMaxBlankPages() + numberOfLeadingBlankPages;
         if (calcValue > numberOfLeadingBlankPages) {
             result = PageCmper(calcValue);
         } else {
@@ -1296,7 +1298,7 @@ PageCmper PartDefinition::calcAssignmentIdFromPageNumber(PageCmper pageId) const
 {
     if (pageId != 0) {
         if (pageId > numberOfLeadingBlankPages) {
-            const int calcValue = int(pageId) + getDocument()->getMaxBlankPages() - numberOfLeadingBlankPages;
+            const int calcValue = int(pageId) + getDocumentRef().getMaxBlankPages() - numberOfLeadingBlankPages;
             return PageCmper(calcValue);
         }
     }
@@ -1416,7 +1418,7 @@ static MusxInstance<T> getIndividualPositioningImpl(const MusxInstanceList<T> in
 
 MusxInstance<RepeatIndividualPositioning> RepeatBack::getIndividualPositioning(StaffCmper staffId) const
 {
-    return getIndividualPositioningImpl(getDocument()->getOthers()->getArray<RepeatBackIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
+    return getIndividualPositioningImpl(getDocumentRef().getOthers()->getArray<RepeatBackIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
 }
 
 RepeatStaffListSet RepeatBack::createStaffListSet() const
@@ -1437,7 +1439,7 @@ std::optional<MeasCmper> RepeatBack::calcTargetMeasure() const
 
     case RepeatActionType::JumpAuto: {
         for (MeasCmper meas = getCmper(); meas > 1; --meas) {
-            if (auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), meas - 1)) {
+            if (auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), meas - 1)) {
                 if (measure->forwardRepeatBar) {
                     return MeasCmper(meas - 1);
                 }
@@ -1478,11 +1480,11 @@ int RepeatEndingStart::calcEndingLength() const
     }
     Cmper x = getCmper() + 1;
     while (true) {
-        auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), x);
+        auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), x);
         if (!measure) {
             return 1;
         }
-        if (measure->hasEnding && getDocument()->getOthers()->get<RepeatEndingStart>(getRequestedPartId(), x)) {
+        if (measure->hasEnding && getDocumentRef().getOthers()->get<RepeatEndingStart>(getRequestedPartId(), x)) {
             break;
         }
         if (--maxLength <= 0) {
@@ -1526,13 +1528,13 @@ bool RepeatEndingStart::calcIsOpen() const
         return true;
     }
     for (Cmper x = getCmper(); true; x++) {
-        auto measure = getDocument()->getOthers()->get<Measure>(getRequestedPartId(), x);
+        auto measure = getDocumentRef().getOthers()->get<Measure>(getRequestedPartId(), x);
         if (!measure) {
             break;
         }
         if (measure->backwardsRepeatBar) {
-            if (auto backRepeat = getDocument()->getOthers()->get<RepeatBack>(getRequestedPartId(), x)) {
-                if (auto repeatOptions = getDocument()->getOptions()->get<options::RepeatOptions>()) {
+            if (auto backRepeat = getDocumentRef().getOthers()->get<RepeatBack>(getRequestedPartId(), x)) {
+                if (auto repeatOptions = getDocumentRef().getOptions()->get<options::RepeatOptions>()) {
                     return (backRepeat->leftVPos - backRepeat->rightVPos) == repeatOptions->bracketHookLen;
                 }
                 return true;
@@ -1544,21 +1546,21 @@ bool RepeatEndingStart::calcIsOpen() const
 
 MusxInstance<RepeatIndividualPositioning> RepeatEndingStart::getIndividualPositioning(StaffCmper staffId) const
 {
-    return getIndividualPositioningImpl(getDocument()->getOthers()->getArray<RepeatEndingStartIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
+    return getIndividualPositioningImpl(getDocumentRef().getOthers()->getArray<RepeatEndingStartIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
 }
 
 MusxInstance<RepeatIndividualPositioning> RepeatEndingStart::getTextIndividualPositioning(StaffCmper staffId) const
 {
-    return getIndividualPositioningImpl(getDocument()->getOthers()->getArray<RepeatEndingTextIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
+    return getIndividualPositioningImpl(getDocumentRef().getOthers()->getArray<RepeatEndingTextIndividualPositioning>(getRequestedPartId(), getCmper()), staffId);
 }
 
 std::string RepeatEndingStart::createEndingText() const
 {
-    if (auto userText = getDocument()->getOthers()->get<RepeatEndingText>(getRequestedPartId(), getCmper())) {
+    if (auto userText = getDocumentRef().getOthers()->get<RepeatEndingText>(getRequestedPartId(), getCmper())) {
         return userText->text;
     }
     std::string result;
-    if (auto passList = getDocument()->getOthers()->get<RepeatPassList>(getRequestedPartId(), getCmper())) {
+    if (auto passList = getDocumentRef().getOthers()->get<RepeatPassList>(getRequestedPartId(), getCmper())) {
         for (int pass : passList->values) {
             if (!result.empty()) {
                 result += ',';
@@ -1566,7 +1568,7 @@ std::string RepeatEndingStart::createEndingText() const
             }
             result += std::to_string(pass);
         }
-        if (auto repeatOptions = getDocument()->getOptions()->get<options::RepeatOptions>()) {
+        if (auto repeatOptions = getDocumentRef().getOptions()->get<options::RepeatOptions>()) {
             if (repeatOptions->addPeriod) {
                 result += '.';
             }
@@ -1586,7 +1588,7 @@ RepeatStaffListSet RepeatEndingStart::createStaffListSet() const
 
 MusxInstance<ShapeDef> ShapeExpressionDef::getShape() const
 {
-    return getDocument()->getOthers()->get<others::ShapeDef>(getRequestedPartId(), shapeDef);
+    return getDocumentRef().getOthers()->get<others::ShapeDef>(getRequestedPartId(), shapeDef);
 }
 
 // ************************
@@ -1653,11 +1655,11 @@ template class StaffListSet<StaffListRepeatScore, StaffListRepeatParts, StaffLis
 
 MusxInstance<Page> StaffSystem::getPage() const
 {
-    const auto part = getDocument()->getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
+    const auto part = getDocumentRef().getOthers()->get<PartDefinition>(SCORE_PARTID, getRequestedPartId());
     if (!part || !part->isLayoutCalculated()) {
         return nullptr;
     }
-    const auto page = getDocument()->getOthers()->get<Page>(getRequestedPartId(), pageId);
+    const auto page = getDocumentRef().getOthers()->get<Page>(getRequestedPartId(), pageId);
     return page && page->isLayoutCalculated() ? page : nullptr;
 }
 
@@ -1673,7 +1675,7 @@ util::Fraction StaffSystem::calcEffectiveScaling() const
 util::Fraction StaffSystem::calcStaffScaling(StaffCmper staffId) const
 {
     if (hasStaffScaling) {
-        if (const auto staffSize = getDocument()->getDetails()->get<details::StaffSize>(getRequestedPartId(), getCmper(), staffId)) {
+        if (const auto staffSize = getDocumentRef().getDetails()->get<details::StaffSize>(getRequestedPartId(), getCmper(), staffId)) {
             return util::Fraction::fromPercent(staffSize->staffPercent);
         }
     }
@@ -1683,7 +1685,7 @@ util::Fraction StaffSystem::calcStaffScaling(StaffCmper staffId) const
 std::pair<util::Fraction, util::Fraction> StaffSystem::calcMinMaxStaffSizes() const
 {
     if (hasStaffScaling) {
-        auto systemStaves = getDocument()->getOthers()->getArray<StaffUsed>(getRequestedPartId(), getCmper());
+        auto systemStaves = getDocumentRef().getOthers()->getArray<StaffUsed>(getRequestedPartId(), getCmper());
         if (!systemStaves.empty()) {
             std::pair<util::Fraction, util::Fraction> result = std::make_pair((std::numeric_limits<util::Fraction>::max)(), (std::numeric_limits<util::Fraction>::min)());
             for (const auto& systemStaff : systemStaves) {
@@ -1725,10 +1727,10 @@ util::EnigmaParsingContext TextBlock::getRawTextCtx(Cmper forPartId, std::option
         default:
             break;
         case TextType::Block:
-            rawText = getDocument()->getTexts()->get<texts::BlockText>(textId);
+            rawText = getDocumentRef().getTexts()->get<texts::BlockText>(textId);
             break;
         case TextType::Expression:
-            rawText = getDocument()->getTexts()->get<texts::ExpressionText>(textId);
+            rawText = getDocumentRef().getTexts()->get<texts::ExpressionText>(textId);
             break;
     }
     if (rawText) {
@@ -1752,14 +1754,14 @@ std::string TextBlock::getText(const DocumentPtr& document, const Cmper textId,
 
 MusxInstance<TextBlock> TextExpressionDef::getTextBlock() const
 {
-    return getDocument()->getOthers()->get<TextBlock>(getRequestedPartId(), textIdKey);
+    return getDocumentRef().getOthers()->get<TextBlock>(getRequestedPartId(), textIdKey);
 }
 
 
 MusxInstance<Enclosure> TextExpressionDef::getEnclosure() const
 {
     if (!hasEnclosure) return nullptr;
-    return getDocument()->getOthers()->get<TextExpressionEnclosure>(getRequestedPartId(), getCmper());
+    return getDocumentRef().getOthers()->get<TextExpressionEnclosure>(getRequestedPartId(), getCmper());
 }
 
 // *********************
@@ -1770,7 +1772,7 @@ util::Fraction StaffUsed::calcEffectiveScaling() const
 {
     util::Fraction result(1);
     if (SystemCmper(getCmper()) > 0) { // if this is a page-view system
-        if (auto system = getDocument()->getOthers()->get<StaffSystem>(getRequestedPartId(), getCmper())) {
+        if (auto system = getDocumentRef().getOthers()->get<StaffSystem>(getRequestedPartId(), getCmper())) {
             result = system->calcEffectiveScaling() * system->calcStaffScaling(staffId);
         }
     }
@@ -1779,7 +1781,7 @@ util::Fraction StaffUsed::calcEffectiveScaling() const
 
 MusxInstance<Staff> StaffUsed::getStaffInstance() const
 {
-    auto retval = getDocument()->getOthers()->get<Staff>(getRequestedPartId(), staffId);
+    auto retval = getDocumentRef().getOthers()->get<Staff>(getRequestedPartId(), staffId);
     if (!retval) {
         MUSX_INTEGRITY_ERROR("Staff " + std::to_string(staffId) + " not found for StaffUsed list " + std::to_string(getCmper()));
     }
@@ -1802,7 +1804,7 @@ MusxInstance<StaffComposite> StaffUsed::getStaffInstance(MeasCmper measureId, Ed
 
 MusxInstance<RepeatIndividualPositioning> TextRepeatAssign::getIndividualPositioning(StaffCmper staffId) const
 {
-    return getIndividualPositioningImpl(getDocument()->getOthers()->getArray<TextRepeatIndividualPositioning>(getRequestedPartId(), textRepeatId),
+    return getIndividualPositioningImpl(getDocumentRef().getOthers()->getArray<TextRepeatIndividualPositioning>(getRequestedPartId(), textRepeatId),
         staffId, static_cast<MeasCmper>(getCmper()));
 }
 
@@ -1823,7 +1825,7 @@ std::optional<MeasCmper> TextRepeatAssign::calcTargetMeasure() const
     }
 
     case RepeatActionType::JumpToMark: {
-        const auto assigns = getDocument()->getOthers()->getArray<others::TextRepeatAssign>(getRequestedPartId());
+        const auto assigns = getDocumentRef().getOthers()->getArray<others::TextRepeatAssign>(getRequestedPartId());
         const auto it = std::find_if(assigns.begin(), assigns.end(), [&](const auto& assign) {
             return assign && assign->textRepeatId == targetValue;
         });
@@ -814,8 +814,8 @@ public:
                 + " strings but has " + std::to_string(strings.size()) + " StringInfo instances.");
         }
         if (!fretSteps.empty() && numFrets != int(fretSteps.size())) {
-            util::Logger::log(util::Logger::LogLevel::Info, "Fret instrument " + std::to_string(getCmper()) + " specifies " + std::to_string(numFrets)
-                + " frets but has " + std::to_string(fretSteps.size()) + " diatonic fret steps specified.");
+            util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Fret instrument " + std::to_string(getCmper()) + " specifies " + std::to_string(numFrets)
+                + " frets but has " + std::to_string(fretSteps.size()) + " diatonic fret steps specified."; });
         }
     }
 
@@ -1113,7 +1113,7 @@ public:
         }
         if (!numberFont) {
             numberFont = std::make_shared<FontInfo>(ptrToThis->getDocument());
-            util::Logger::log(util::Logger::LogLevel::Info, "Marking category " + std::to_string(getCmper()) + " is missing number font.");
+            util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Marking category " + std::to_string(getCmper()) + " is missing number font."; });
         }
     }
 
@@ -1890,6 +1890,11 @@ public:
     /// @brief Resolver function used by factory to compute system and measure information for all pages.
     static void calcSystemInfo(const DocumentPtr& document);
 
+    /// @brief Computes system and measure information for the pages of one score or linked part.
+    /// @param document The document to update.
+    /// @param partId The score or linked part whose pages to update.
+    static void calcSystemInfo(const DocumentPtr& document, Cmper partId);
+
     constexpr static std::string_view XmlNodeName = "pageSpec"; ///< The XML node name for this type.
     static const xml::XmlElementArray<Page>& xmlMappingArray(); ///< Required for musx::factory::FieldPopulator.
 };
@@ -2885,12 +2890,12 @@ public:
         this->OthersBase::integrityCheck(ptrToThis);
         if (startMeas == 0 || endMeas == 0) {
             if (getSourcePartId() == SCORE_PARTID) {
-                util::Logger::log(util::Logger::LogLevel::Info, "Layout for system " + std::to_string(getCmper())
-                    + " of part " + std::to_string(getSourcePartId()) + " has not been calculated.");
+                util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Layout for system " + std::to_string(getCmper())
+                    + " of part " + std::to_string(getSourcePartId()) + " has not been calculated."; });
             } else {
                 // Finale can retain zero-valued system placeholders until a linked-part layout is updated.
-                util::Logger::log(util::Logger::LogLevel::Verbose, "Layout for system " + std::to_string(getCmper())
-                    + " of part " + std::to_string(getSourcePartId()) + " has not been calculated.");
+                util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "Layout for system " + std::to_string(getCmper())
+                    + " of part " + std::to_string(getSourcePartId()) + " has not been calculated."; });
             }
         }
     }
@@ -3075,8 +3080,8 @@ public:
         } else if (!lineSpacingPercentage && !lineSpacingEvpu) {
             lineSpacingPercentage = options::TextOptions::DEFAULT_LINE_SPACING_PERCENT;
             util::Logger::log(util::Logger::LogLevel::Verbose,
-                "Text block specifies no line spacing. "
-                + std::to_string(options::TextOptions::DEFAULT_LINE_SPACING_PERCENT) + " percent was assumed.");
+                [&]() { return "Text block specifies no line spacing. "
+                + std::to_string(options::TextOptions::DEFAULT_LINE_SPACING_PERCENT) + " percent was assumed."; });
         }
     }
 
@@ -506,12 +506,12 @@ bool ShapeDef::isBlank() const
     }
     // Some legacy documents retain a nonzero reference to an intentionally empty
     // instruction collection. A missing collection is unresolved rather than blank.
-    const auto instructions = getDocument()->getOthers()->get<ShapeInstructionList>(
+    const auto instructions = getDocumentRef().getOthers()->get<ShapeInstructionList>(
         getRequestedPartId(), instructionList);
     if (!instructions) {
         util::Logger::log(util::Logger::LogLevel::Verbose,
-            "ShapeDef " + std::to_string(getCmper()) + " references missing instruction list "
-                + std::to_string(instructionList) + ".");
+            [&]() { return "ShapeDef " + std::to_string(getCmper()) + " references missing instruction list "
+                + std::to_string(instructionList) + "."; });
         return false;
     }
     return instructions->instructions.empty();
@@ -523,8 +523,8 @@ bool ShapeDef::iterateInstructions(std::function<bool(ShapeDefInstructionType, s
         return true; // nothing to do if no data
     }
 
-    auto insts = getDocument()->getOthers()->get<ShapeInstructionList>(getRequestedPartId(), instructionList);
-    auto data = getDocument()->getOthers()->get<ShapeData>(getRequestedPartId(), dataList);
+    auto insts = getDocumentRef().getOthers()->get<ShapeInstructionList>(getRequestedPartId(), instructionList);
+    auto data = getDocumentRef().getOthers()->get<ShapeData>(getRequestedPartId(), dataList);
     bool result = true;
 
     if (insts && data) {
@@ -78,6 +78,16 @@ void PartContextRebinder<details::CenterShape>::rebind(const std::shared_ptr<det
 // ********************
 
 EntryInfoPtr smartshape::EndPoint::calcAssociatedEntry(bool findExact) const
+{
+    return calcAssociatedEntryImpl(nullptr, findExact);
+}
+
+EntryInfoPtr smartshape::EndPoint::calcAssociatedEntry(EntryInfoResolver& resolver, bool findExact) const
+{
+    return calcAssociatedEntryImpl(&resolver, findExact);
+}
+
+EntryInfoPtr smartshape::EndPoint::calcAssociatedEntryImpl(EntryInfoResolver* resolver, bool findExact) const
 {
     const auto doc = getDocument();
     auto shapeParent = getParent<others::SmartShape>();
@@ -88,7 +98,9 @@ EntryInfoPtr smartshape::EndPoint::calcAssociatedEntry(bool findExact) const
 
     EntryInfoPtr result;
     if (entryNumber != 0) {
-        result = EntryInfoPtr::fromEntryNumber(doc, forPartId, entryNumber);
+        result = (resolver && resolver->getRequestedPartId() == forPartId)
+            ? resolver->resolve(entryNumber)
+            : EntryInfoPtr::fromEntryNumber(doc, forPartId, entryNumber);
         if (!result) {
             MUSX_INTEGRITY_ERROR("SmartShape at Staff " + std::to_string(staffId) + " Measure " + std::to_string(measId)
                 + " contains endpoint with invalid entry number " + std::to_string(entryNumber));
@@ -130,9 +142,9 @@ MusxInstance<others::SmartShapeMeasureAssign> smartshape::EndPoint::getMeasureAs
     MUSX_ASSERT_IF(!shapeParent) {
         throw std::logic_error("Unknown parent type for SmartShape::EndPoint.");
     }
-    if (auto measure = getDocument()->getOthers()->get<others::Measure>(shapeParent->getRequestedPartId(), measId)) {
+    if (auto measure = getDocumentRef().getOthers()->get<others::Measure>(shapeParent->getRequestedPartId(), measId)) {
         if (measure->hasSmartShape) {
-            auto assigns = getDocument()->getOthers()->getArray<others::SmartShapeMeasureAssign>(shapeParent->getRequestedPartId(), measId);
+            auto assigns = getDocumentRef().getOthers()->getArray<others::SmartShapeMeasureAssign>(shapeParent->getRequestedPartId(), measId);
             for (const auto& assign : assigns) {
                 if (assign->shapeNum == shapeParent->getCmper()) {
                     return assign;
@@ -151,9 +163,9 @@ MusxInstance<details::SmartShapeEntryAssign> smartshape::EndPoint::getEntryAssig
     }
     if (entryNumber != 0) {
         Cmper shapeId = shapeParent->getCmper();
-        if (auto entry = getDocument()->getEntries()->get(entryNumber)) {
+        if (auto entry = getDocumentRef().getEntries()->get(entryNumber)) {
             if (entry->smartShapeDetail) {
-                auto assigns = getDocument()->getDetails()->getArray<details::SmartShapeEntryAssign>(shapeParent->getRequestedPartId(), entryNumber);
+                auto assigns = getDocumentRef().getDetails()->getArray<details::SmartShapeEntryAssign>(shapeParent->getRequestedPartId(), entryNumber);
                 for (const auto& assign : assigns) {
                     if (assign->shapeNum == shapeId) {
                         return assign;
@@ -195,7 +207,7 @@ bool smartshape::EndPoint::calcIsValid() const
             return false;
         }
     }
-    return getDocument()->getOthers()->get<others::Measure>(SCORE_PARTID, measId) != nullptr;
+    return getDocumentRef().getOthers()->get<others::Measure>(SCORE_PARTID, measId) != nullptr;
 }
 
 util::Fraction smartshape::EndPoint::calcPosition() const
@@ -217,8 +229,9 @@ util::Fraction smartshape::EndPoint::calcGlobalPosition() const
     }
     if (!entryNumber) {
         const auto rawPosition = util::Fraction::fromEdu(eduPosition);
-        if (auto meas = getDocument()->getOthers()->get<others::Measure>(shapeParent->getRequestedPartId(), measId)) {
-            return rawPosition * meas->calcTimeStretch(staffId);
+        const auto& timeline = getDocumentRef().getGlobalTimeline(shapeParent->getRequestedPartId());
+        if (measId >= 1 && measId <= timeline.getMeasureCount()) {
+            return rawPosition * timeline.getTimeStretch(measId, staffId);
         }
         return rawPosition;
     }
@@ -330,9 +343,9 @@ bool others::SmartShape::calcAppliesTo(const EntryInfoPtr& entryInfo) const
     }
     const auto entryPos = entryInfo->elapsedDuration;
     auto range = createMusicRange();
-    if (auto meas = entry->getDocument()->getOthers()->get<others::Measure>(entryInfo.getFrame()->getRequestedPartId(), entryInfo.getMeasure())) {
+    if (auto meas = entry->getDocumentRef().getOthers()->get<others::Measure>(entryInfo.getFrame()->getRequestedPartId(), entryInfo.getMeasure())) {
         if (meas->hasSmartShape) {
-            auto shapeAssigns = entry->getDocument()->getOthers()->getArray<others::SmartShapeMeasureAssign>(entryInfo.getFrame()->getRequestedPartId(), entryInfo.getMeasure());
+            auto shapeAssigns = entry->getDocumentRef().getOthers()->getArray<others::SmartShapeMeasureAssign>(entryInfo.getFrame()->getRequestedPartId(), entryInfo.getMeasure());
             for (const auto& asgn : shapeAssigns) {
                 if (asgn->shapeNum == getCmper()) {
                     if (range.contains(entryMeasureId, entryPos)) {
@@ -358,7 +371,7 @@ MusicRange others::SmartShape::createGlobalMusicRange() const
 bool others::SmartShape::iterateEntries(std::function<bool(const EntryInfoPtr&)> iterator, DeferredReference<MusxInstanceList<others::StaffUsed>> staffList) const
 {
     if (!staffList) {
-        staffList.emplace(getDocument()->getScrollViewStaves(getRequestedPartId()));
+        staffList.emplace(getDocumentRef().getScrollViewStaves(getRequestedPartId()));
     }
     auto startIndex = staffList->getIndexForStaff(startTermSeg->endPoint->staffId);
     auto endIndex = staffList->getIndexForStaff(endTermSeg->endPoint->staffId);
@@ -513,7 +526,7 @@ bool others::SmartShape::calcIsPseudoTie(utils::PseudoTieMode mode, const EntryI
 
 util::EnigmaParsingContext others::SmartShapeCustomLine::getRawTextCtx(Cmper forPartId, Cmper rawTextId) const
 {
-    if (auto rawText = getDocument()->getTexts()->get<texts::SmartShapeText>(rawTextId)) {
+    if (auto rawText = getDocumentRef().getTexts()->get<texts::SmartShapeText>(rawTextId)) {
         return rawText->getRawTextCtx(rawText, forPartId);
     }
     return {};
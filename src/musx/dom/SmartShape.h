@@ -36,6 +36,7 @@ enum class PseudoTieMode;
 namespace dom {
 
 class EntryInfoPtr;
+class EntryInfoResolver;
 
 namespace details {
 class SmartShapeEntryAssign;
@@ -165,6 +166,13 @@ public:
     /// @return The entry if the endpoint is entry-attached or measure-attached within 1 Edu of an entry. Null if not.
     [[nodiscard]] EntryInfoPtr calcAssociatedEntry(bool findExact = false) const;
 
+    /// @brief Calculates the entry associated with the endpoint, reusing the entry frames already built by @p resolver.
+    ///
+    /// Use this overload when calculating the entries for many endpoints. The result is the same as #calcAssociatedEntry.
+    /// @param resolver A resolver for the requested part of the parent smart shape. If it is for a different part, it is not used.
+    /// @param findExact See #calcAssociatedEntry.
+    [[nodiscard]] EntryInfoPtr calcAssociatedEntry(EntryInfoResolver& resolver, bool findExact = false) const;
+
     /// @brief Gets the measure assignment for this endpoint or null if none.
     [[nodiscard]] MusxInstance<others::SmartShapeMeasureAssign> getMeasureAssignment() const;
 
@@ -178,6 +186,9 @@ public:
     [[nodiscard]] MusxInstance<others::StaffComposite> createCurrentStaff() const;
 
     static const xml::XmlElementArray<EndPoint>& xmlMappingArray(); ///< Required for musx::factory::FieldPopulator.
+
+private:
+    EntryInfoPtr calcAssociatedEntryImpl(EntryInfoResolver* resolver, bool findExact) const;
 };
 
 /**
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/dom/SmartShapeIndex.h"
+
+#include <algorithm>
+
+#include "musx/musx.h"
+
+namespace musx {
+namespace dom {
+
+SmartShapeIndex::SmartShapeIndex(const DocumentPtr& document, Cmper partId)
+{
+    EntryInfoResolver resolver(document, partId);
+    auto resolveEntry = [&](const smartshape::EndPoint& endPoint) -> EntryNumber {
+        if (endPoint.entryNumber != 0) {
+            return endPoint.entryNumber;
+        }
+        if (const auto entryInfo = endPoint.calcAssociatedEntry(resolver)) {
+            return entryInfo->getEntry()->getEntryNumber();
+        }
+        return 0;
+    };
+
+    for (const auto& assign : document->getOthers()->getArray<others::SmartShapeMeasureAssign>(partId)) {
+        const auto shape = document->getOthers()->get<others::SmartShape>(partId, assign->shapeNum);
+        if (!shape) {
+            continue;
+        }
+        const auto& startPoint = *shape->startTermSeg->endPoint;
+        const auto& endPoint = *shape->endTermSeg->endPoint;
+        const MeasCmper measureId = MeasCmper(assign->getCmper());
+        auto addLocation = [&](StaffCmper staffId) {
+            auto& shapes = m_shapesByLocation[{ staffId, measureId }];
+            if (std::find(shapes.begin(), shapes.end(), shape->getCmper()) == shapes.end()) {
+                shapes.push_back(shape->getCmper());
+            }
+        };
+        addLocation(startPoint.staffId);
+        if (endPoint.staffId != startPoint.staffId) {
+            addLocation(endPoint.staffId);
+        }
+
+        auto [it, inserted] = m_endpoints.try_emplace(shape->getCmper());
+        if (!inserted) {
+            continue; // the shape is assigned to every measure it spans, but its endpoints only need resolving once
+        }
+        Endpoints& endpoints = it->second;
+        endpoints.startStaff = startPoint.staffId;
+        endpoints.startMeasure = startPoint.measId;
+        endpoints.endStaff = endPoint.staffId;
+        endpoints.endMeasure = endPoint.measId;
+        endpoints.startEntry = resolveEntry(startPoint);
+        endpoints.endEntry = resolveEntry(endPoint);
+        if (endpoints.startEntry) {
+            m_startingShapes[endpoints.startEntry].push_back(shape->getCmper());
+        }
+        if (endpoints.endEntry) {
+            m_endingShapes[endpoints.endEntry].push_back(shape->getCmper());
+        }
+    }
+}
+
+const std::vector<Cmper>& SmartShapeIndex::getStartingShapes(EntryNumber entryNumber) const
+{
+    static const std::vector<Cmper> empty;
+    const auto it = m_startingShapes.find(entryNumber);
+    return it != m_startingShapes.end() ? it->second : empty;
+}
+
+const std::vector<Cmper>& SmartShapeIndex::getEndingShapes(EntryNumber entryNumber) const
+{
+    static const std::vector<Cmper> empty;
+    const auto it = m_endingShapes.find(entryNumber);
+    return it != m_endingShapes.end() ? it->second : empty;
+}
+
+std::vector<Cmper> SmartShapeIndex::getShapesInRange(StaffCmper staffId, MeasCmper startMeasure, MeasCmper endMeasure) const
+{
+    std::vector<Cmper> result;
+    const auto last = m_shapesByLocation.upper_bound({ staffId, endMeasure });
+    for (auto it = m_shapesByLocation.lower_bound({ staffId, startMeasure }); it != last; ++it) {
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+const SmartShapeIndex::Endpoints* SmartShapeIndex::getEndpoints(Cmper shapeId) const
+{
+    const auto it = m_endpoints.find(shapeId);
+    return it != m_endpoints.end() ? &it->second : nullptr;
+}
+
+} // namespace dom
+} // namespace musx
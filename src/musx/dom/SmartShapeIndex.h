@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Entries.h"
+
+namespace musx {
+namespace dom {
+
+/**
+ * @class SmartShapeIndex
+ * @brief Per-part index of smart shapes by the entries and measures they touch.
+ *
+ * The index is built once from the part's @ref others::SmartShapeMeasureAssign records. Each shape's endpoints are
+ * resolved to entries when it is built, including beat-attached endpoints, which are resolved with
+ * @ref smartshape::EndPoint::calcAssociatedEntry. That turns "which shapes start or end on this entry" into a hash
+ * lookup and "which shapes touch these measures on this staff" into an ordered range scan, where the alternative is
+ * to load and resolve every shape in a measure for every entry.
+ *
+ * Shapes are listed in the order of their measure assignments, which matches the order used by
+ * @ref EntryInfoPtr::iterateStartingSmartShapes.
+ *
+ * This is not a Finale data class. Obtain it with @ref Document::getSmartShapeIndex, which builds it on first use.
+ */
+class SmartShapeIndex
+{
+public:
+    /// @brief The resolved endpoints of one smart shape.
+    struct Endpoints
+    {
+        EntryNumber startEntry{};   ///< The start entry, or zero if the start endpoint does not resolve to an entry.
+        EntryNumber endEntry{};     ///< The end entry, or zero if the end endpoint does not resolve to an entry.
+        StaffCmper startStaff{};    ///< The start staff.
+        MeasCmper startMeasure{};   ///< The start measure.
+        StaffCmper endStaff{};      ///< The end staff.
+        MeasCmper endMeasure{};     ///< The end measure.
+    };
+
+    /// @brief Builds the index for a score or linked part.
+    /// @param document The document to index.
+    /// @param partId The score or linked part to index.
+    SmartShapeIndex(const DocumentPtr& document, Cmper partId);
+
+    /// @brief Returns the shapes that start on an entry, whether entry-attached or resolved from a beat position.
+    /// @return The shape ids, which are empty if none.
+    [[nodiscard]]
+    const std::vector<Cmper>& getStartingShapes(EntryNumber entryNumber) const;
+
+    /// @brief Returns the shapes that end on an entry, whether entry-attached or resolved from a beat position.
+    /// @return The shape ids, which are empty if none.
+    [[nodiscard]]
+    const std::vector<Cmper>& getEndingShapes(EntryNumber entryNumber) const;
+
+    /// @brief Returns the shapes assigned to any measure in a range on a staff. A shape is on a staff if either endpoint is.
+    /// @param staffId The staff.
+    /// @param startMeasure The first measure of the range.
+    /// @param endMeasure The last measure of the range (inclusive).
+    /// @return The shape ids in ascending order, each listed once.
+    [[nodiscard]]
+    std::vector<Cmper> getShapesInRange(StaffCmper staffId, MeasCmper startMeasure, MeasCmper endMeasure) const;
+
+    /// @brief Returns the resolved endpoints of a shape, or nullptr if the shape is not in the index.
+    [[nodiscard]]
+    const Endpoints* getEndpoints(Cmper shapeId) const;
+
+    /// @brief Returns the number of indexed shapes.
+    [[nodiscard]]
+    size_t getShapeCount() const { return m_endpoints.size(); }
+
+private:
+    std::unordered_map<EntryNumber, std::vector<Cmper>> m_startingShapes;
+    std::unordered_map<EntryNumber, std::vector<Cmper>> m_endingShapes;
+    std::map<std::pair<StaffCmper, MeasCmper>, std::vector<Cmper>> m_shapesByLocation;
+    std::unordered_map<Cmper, Endpoints> m_endpoints;
+};
+
+} // namespace dom
+} // namespace musx
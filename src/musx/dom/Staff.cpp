@@ -19,7 +19,10 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  * THE SOFTWARE.
  */
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <cstdlib>
 #include <exception>
@@ -38,23 +41,50 @@ void Staff::calcAllAutoNumberValues(const DocumentPtr& document)
 {
     auto scrollViewList = document->getScrollViewStaves(SCORE_PARTID);
 
-    // Map to track counts for instUuid
-    std::unordered_map<std::string, int> instUuidCounts;
+    // Intern each staff's instUuid once. Instrument ids are hashes, so a UUID whose id is already taken by a
+    // different UUID gets its own key from the exact string.
+    std::vector<std::optional<size_t>> uuidKeys(scrollViewList.size());
+    {
+        std::unordered_map<InstrumentId, std::pair<std::string_view, size_t>> keysById;
+        std::unordered_map<std::string_view, size_t> collidedKeys;
+        size_t nextKey = 0;
+        for (size_t x = 0; x < scrollViewList.size(); x++) {
+            auto staff = scrollViewList[x]->getStaffInstance();
+            if (!staff || staff->instUuid.empty()) {
+                continue;
+            }
+            const auto [it, inserted] = keysById.try_emplace(staff->calcInstrumentId(), staff->instUuid, nextKey);
+            if (inserted) {
+                uuidKeys[x] = nextKey++;
+            } else if (it->second.first == staff->instUuid) {
+                uuidKeys[x] = it->second.second;
+            } else {
+                const auto [collided, added] = collidedKeys.try_emplace(staff->instUuid, nextKey);
+                if (added) {
+                    nextKey++;
+                }
+                uuidKeys[x] = collided->second;
+            }
+        }
+    }
+
+    // Map to track counts for instUuid, keyed by interned uuid key
+    std::unordered_map<size_t, int> instUuidCounts;
     std::unordered_set<Cmper> countedMultistaffGroups;
 
     // Pass 1: Check if any instUuid has auto-numbering disabled
-    std::unordered_set<std::string> disabledInstUuids;
-    for (const auto& instrumentUsed : scrollViewList) {
-        auto staff = instrumentUsed->getStaffInstance();
-        if (staff && !staff->useAutoNumbering) {
-            disabledInstUuids.insert(staff->instUuid);
+    std::unordered_set<size_t> disabledInstUuids;
+    for (size_t x = 0; x < scrollViewList.size(); x++) {
+        auto staff = scrollViewList[x]->getStaffInstance();
+        if (staff && uuidKeys[x] && !staff->useAutoNumbering) {
+            disabledInstUuids.insert(*uuidKeys[x]);
         }
     }
 
     // Pass 2: Count occurrences of instUuid, considering multistaff instruments
-    for (const auto& instrumentUsed : scrollViewList) {
-        auto staff = instrumentUsed->getStaffInstance();
-        if (!staff || staff->instUuid.empty() || disabledInstUuids.count(staff->instUuid)) {
+    for (size_t x = 0; x < scrollViewList.size(); x++) {
+        auto staff = scrollViewList[x]->getStaffInstance();
+        if (!staff || !uuidKeys[x] || disabledInstUuids.count(*uuidKeys[x])) {
             continue;
         }
 
@@ -66,7 +96,7 @@ void Staff::calcAllAutoNumberValues(const DocumentPtr& document)
             }
             countedMultistaffGroups.insert(multiStaffGroup->getCmper());
         }
-        instUuidCounts[staff->instUuid]++;
+        instUuidCounts[*uuidKeys[x]]++;
     }
 
     // Pass 2.1: Remove singleton or empty instUuid counts, including single multistaff instruments
@@ -77,17 +107,18 @@ void Staff::calcAllAutoNumberValues(const DocumentPtr& document)
     }
 
     // Pass 3: Assign auto-numbering values
-    std::unordered_map<std::string, int> instUuidNumbers;
+    std::unordered_map<size_t, int> instUuidNumbers;
     countedMultistaffGroups.clear(); // Reset for numbering
 
-    for (const auto& instrumentUsed : scrollViewList) {
-        auto staff = instrumentUsed->getStaffInstance();
+    for (size_t x = 0; x < scrollViewList.size(); x++) {
+        auto staff = scrollViewList[x]->getStaffInstance();
         Staff* mutableStaff = const_cast<Staff*>(staff.get());
         if (!staff) continue;
-        if (staff->instUuid.empty() || disabledInstUuids.count(staff->instUuid)) {
+        if (!uuidKeys[x] || disabledInstUuids.count(*uuidKeys[x])) {
             mutableStaff->autoNumberValue = std::nullopt; // No numbering for disabled or empty instUuid
             continue;
         }
+        const size_t uuidKey = *uuidKeys[x];
 
         // Check if the staff is part of a multistaff instrument
         auto multiStaffGroup = staff->getMultiStaffInstGroup();
@@ -95,12 +126,12 @@ void Staff::calcAllAutoNumberValues(const DocumentPtr& document)
             if (countedMultistaffGroups.find(multiStaffGroup->getCmper()) == countedMultistaffGroups.end()) {
                 // Assign a number for this multistaff group
                 countedMultistaffGroups.insert(multiStaffGroup->getCmper());
-                instUuidNumbers[staff->instUuid]++;
+                instUuidNumbers[uuidKey]++;
             }
             // Assign the same number to all staves in the group
-            auto groupNumber = instUuidNumbers[staff->instUuid];
-            for (size_t x = 0; x < multiStaffGroup->staffNums.size(); x++) {
-                auto groupStaff = multiStaffGroup->getStaffInstanceAtIndex(x);
+            auto groupNumber = instUuidNumbers[uuidKey];
+            for (size_t y = 0; y < multiStaffGroup->staffNums.size(); y++) {
+                auto groupStaff = multiStaffGroup->getStaffInstanceAtIndex(y);
                 if (groupStaff) {
                     Staff* mutableGroupStaff = const_cast<Staff*>(groupStaff.get());
                     mutableGroupStaff->autoNumberValue = groupNumber;
@@ -110,10 +141,10 @@ void Staff::calcAllAutoNumberValues(const DocumentPtr& document)
         }
 
         // Assign a number for single staves
-        instUuidNumbers[staff->instUuid]++;
-        mutableStaff->autoNumberValue = instUuidNumbers[staff->instUuid];
+        mutableStaff->autoNumberValue = ++instUuidNumbers[uuidKey];
     }
 }
+
 template <typename SubType>
 void Staff::calcAllRuntimeValues(const DocumentPtr& document)
 {
@@ -298,7 +329,7 @@ bool Staff::calcShowName() const
 MusxInstance<MultiStaffInstrumentGroup> Staff::getMultiStaffInstGroup() const
 {
     if (multiStaffInstId) {
-        if (auto retval = getDocument()->getOthers()->get<MultiStaffInstrumentGroup>(SCORE_PARTID, multiStaffInstId)) {
+        if (auto retval = getDocumentRef().getOthers()->get<MultiStaffInstrumentGroup>(SCORE_PARTID, multiStaffInstId)) {
             return retval;
         }
         MUSX_INTEGRITY_ERROR("Staff " + std::to_string(getCmper()) + " points to non-existent MultiStaffInstrumentGroup " + std::to_string(multiStaffInstId));
@@ -313,14 +344,14 @@ MusxInstance<details::StaffGroup> Staff::getMultiStaffInstVisualGroup(Cmper forP
             // This helper can be reached while factory resolvers are formatting diagnostics, before
             // the score instrument map is constructed. In that case, allow the caller to fall back
             // to the staff's own name rather than making name lookup depend on factory ordering.
-            if (const auto& instruments = getDocument()->getInstrumentsIfAvailable()) {
+            if (const auto& instruments = getDocumentRef().getInstrumentsIfAvailable()) {
                 if (const auto result = instruments->getInstrumentForStaff(getCmper())) {
                     return result->staffGroupId;
                 }
             }
             return std::nullopt;
         }
-        const auto map = getDocument()->createInstrumentMap(forPartId);
+        const auto map = getDocumentRef().createInstrumentMap(forPartId);
         auto result = map.getInstrumentForStaff(getCmper());
         if (result) {
             return result->staffGroupId;
@@ -328,7 +359,7 @@ MusxInstance<details::StaffGroup> Staff::getMultiStaffInstVisualGroup(Cmper forP
         return std::nullopt;
     }();
     if (groupId.value_or(0) != 0) {
-        if (auto retval = getDocument()->getDetails()->get<details::StaffGroup>(forPartId, getDocument()->calcScrollViewCmper(forPartId), groupId.value())) {
+        if (auto retval = getDocumentRef().getDetails()->get<details::StaffGroup>(forPartId, getDocumentRef().calcScrollViewCmper(forPartId), groupId.value())) {
             return retval;
         } else {
             MUSX_INTEGRITY_ERROR("Instrument map " + std::to_string(getCmper()) + " points to non-existent StaffGroup " + std::to_string(groupId.value())
@@ -346,7 +377,7 @@ util::EnigmaParsingContext Staff::getFullInstrumentNameCtx(Cmper forPartId, bool
                 return group->getFullNameCtx();
             }
         }
-        if (const auto block = getDocument()->getOthers()->get<TextBlock>(forPartId, fullNameTextId)) {
+        if (const auto block = getDocumentRef().getOthers()->get<TextBlock>(forPartId, fullNameTextId)) {
             return block->getRawTextCtx(forPartId);
         }
         return {};
@@ -373,7 +404,7 @@ util::EnigmaParsingContext Staff::getAbbreviatedInstrumentNameCtx(Cmper forPartI
                 return group->getAbbreviatedNameCtx();
             }
         }
-        if (const auto block = getDocument()->getOthers()->get<TextBlock>(forPartId, abbrvNameTextId)) {
+        if (const auto block = getDocumentRef().getOthers()->get<TextBlock>(forPartId, abbrvNameTextId)) {
             return block->getRawTextCtx(forPartId);
         }
         return {};
@@ -394,14 +425,14 @@ std::string Staff::getAbbreviatedInstrumentName(util::EnigmaString::AccidentalSt
 
 std::string Staff::getPlaybackRouteName() const
 {
-    const auto staffPlayData = getDocument()->getOthers()->get<StaffPlayData>(getRequestedPartId(), getCmper());
+    const auto staffPlayData = getDocumentRef().getOthers()->get<StaffPlayData>(getRequestedPartId(), getCmper());
     if (!staffPlayData) {
         return {};
     }
 
     const auto findRouteName = [this](const std::shared_ptr<StaffPlayData::PlaybackSettings>& settings) {
         if (settings) {
-            const auto routeName = getDocument()->getOthers()->get<PlaybackRouteName>(
+            const auto routeName = getDocumentRef().getOthers()->get<PlaybackRouteName>(
                 getRequestedPartId(), settings->getPlaybackRouteId());
             if (routeName && !routeName->name.empty()) {
                 return routeName->name;
@@ -434,14 +465,14 @@ MusxInstance<details::ShapeNoteBase> Staff::getNoteShapes() const
     if (useNoteShapes) {
         if (noteShapesId) {
             if (noteShapesFromStyle) {
-                return getDocument()->getDetails()->get<details::ShapeNoteStyle>(getRequestedPartId(), noteShapesId, 0);
+                return getDocumentRef().getDetails()->get<details::ShapeNoteStyle>(getRequestedPartId(), noteShapesId, 0);
             }
-            return getDocument()->getDetails()->get<details::ShapeNote>(getRequestedPartId(), noteShapesId, 0);
+            return getDocumentRef().getDetails()->get<details::ShapeNote>(getRequestedPartId(), noteShapesId, 0);
         }
     } else {
-        if (auto noteRestOptions = getDocument()->getOptions()->get<options::NoteRestOptions>()) {
+        if (auto noteRestOptions = getDocumentRef().getOptions()->get<options::NoteRestOptions>()) {
             if (noteRestOptions->doShapeNotes) {
-                return getDocument()->getDetails()->get<details::ShapeNote>(getRequestedPartId(), 0, 0);
+                return getDocumentRef().getDetails()->get<details::ShapeNote>(getRequestedPartId(), 0, 0);
             }
         }
     }
@@ -461,13 +492,13 @@ MusxInstance<NamePositioning> Staff::getNamePosition() const
 
     const Cmper posCmper = isForFull ? fullNamePosId : abrvNamePosId;
     if (posCmper) {
-        if (auto pos = getDocument()->getOthers()->get<NamePositionType>(getRequestedPartId(), posCmper)) {
+        if (auto pos = getDocumentRef().getOthers()->get<NamePositionType>(getRequestedPartId(), posCmper)) {
             return pos;
         }
     }
 
     MusxInstance<NamePositioning> defaultValue;
-    if (auto staffOptions = getDocument()->getOptions()->get<options::StaffOptions>()) {
+    if (auto staffOptions = getDocumentRef().getOptions()->get<options::StaffOptions>()) {
         if constexpr (isForFull) {
             defaultValue = staffOptions->namePos;
         } else {
@@ -712,15 +743,15 @@ Evpu Staff::calcBaselinePositionImpl(SystemCmper systemId, std::optional<Cmper>
 
     Evpu result = calcBaselineZeroPosition();
 
-    auto globalArray = getDocument()->getDetails()->getArray<BaselineType>(getRequestedPartId(), Cmper{0}, Cmper{0});
+    auto globalArray = getDocumentRef().getDetails()->getArray<BaselineType>(getRequestedPartId(), Cmper{0}, Cmper{0});
     if (auto globalBaseline = findBaseline(globalArray)) {
         result += globalBaseline->baselineDisplacement;
     }
-    auto staffArray = getDocument()->getDetails()->getArray<BaselineType>(getRequestedPartId(), Cmper{0}, getCmper());
+    auto staffArray = getDocumentRef().getDetails()->getArray<BaselineType>(getRequestedPartId(), Cmper{0}, getCmper());
     if (auto staffBaseline = findBaseline(staffArray)) {
         result += staffBaseline->baselineDisplacement;
     }
-    auto systemArray = getDocument()->getDetails()->getArray<typename BaselineType::PerSystemType>(getRequestedPartId(), systemId, getCmper());
+    auto systemArray = getDocumentRef().getDetails()->getArray<typename BaselineType::PerSystemType>(getRequestedPartId(), systemId, getCmper());
     if (auto systemBaseline = findBaseline(systemArray)) {
         result += systemBaseline->baselineDisplacement;
     }
@@ -774,21 +805,21 @@ std::vector<LyricsLineInfo> Staff::createLyricsLineInfo(SystemCmper systemId) co
         }
     };
 
-    if (auto system = getDocument()->getOthers()->get<StaffSystem>(getRequestedPartId(), systemId)) {
+    if (auto system = getDocumentRef().getOthers()->get<StaffSystem>(getRequestedPartId(), systemId)) {
         for (MeasCmper measId = system->startMeas; measId < system->endMeas; measId++) {
-            if (auto gfHold = getDocument()->getDetails()->get<details::GFrameHold>(getRequestedPartId(), getCmper(), measId)) {
+            if (auto gfHold = getDocumentRef().getDetails()->get<details::GFrameHold>(getRequestedPartId(), getCmper(), measId)) {
                 for (Cmper frameId : gfHold->frames) {
                     if (frameId != 0) {
-                        auto frames = getDocument()->getOthers()->getArray<Frame>(getRequestedPartId(), frameId);
+                        auto frames = getDocumentRef().getOthers()->getArray<Frame>(getRequestedPartId(), frameId);
                         for (const auto& frame : frames) {
                             if (!frame->startEntry) {
                                 continue;
                             }
                             frame->iterateRawEntries([&](const MusxInstance<Entry>& entry) -> bool {
                                 if (entry->lyricDetail) {
-                                    addLyricsLines(getDocument()->getDetails()->getArray<details::LyricAssignVerse>(getRequestedPartId(), entry->getEntryNumber()));
-                                    addLyricsLines(getDocument()->getDetails()->getArray<details::LyricAssignChorus>(getRequestedPartId(), entry->getEntryNumber()));
-                                    addLyricsLines(getDocument()->getDetails()->getArray<details::LyricAssignSection>(getRequestedPartId(), entry->getEntryNumber()));
+                                    addLyricsLines(getDocumentRef().getDetails()->getArray<details::LyricAssignVerse>(getRequestedPartId(), entry->getEntryNumber()));
+                                    addLyricsLines(getDocumentRef().getDetails()->getArray<details::LyricAssignChorus>(getRequestedPartId(), entry->getEntryNumber()));
+                                    addLyricsLines(getDocumentRef().getDetails()->getArray<details::LyricAssignSection>(getRequestedPartId(), entry->getEntryNumber()));
                                 }
                                 return true;
                             });
@@ -830,28 +861,18 @@ std::pair<int, int> Staff::calcTranspositionInterval() const
 MusxInstanceList<PartDefinition> Staff::getContainingParts(bool includeScore) const
 {
     MusxInstanceList<PartDefinition> result(getDocument(), SCORE_PARTID);
-    auto parts = getDocument()->getOthers()->getArray<PartDefinition>(SCORE_PARTID);
-    for (const auto& part : parts) {
-        if (!includeScore && part->getCmper() == SCORE_PARTID) {
-            continue;
-        }
-        auto scrollView = getDocument()->getScrollViewStaves(part->getCmper());
-        for (const auto& next : scrollView) {
-            if (next->staffId == this->getCmper()) {
-                result.push_back(part);
-                break;
-            }
-        }
+    for (auto& part : getDocumentRef().getPartsContainingStaff(getCmper(), includeScore)) {
+        result.push_back(std::move(part));
     }
     return result;
 }
 
 MusxInstance<PartDefinition> Staff::firstContainingPart() const
 {
-    auto parts = getDocument()->getOthers()->getArray<PartDefinition>(SCORE_PARTID);
+    auto parts = getDocumentRef().getOthers()->getArray<PartDefinition>(SCORE_PARTID);
     for (const auto& part : parts) {
         if (part->getCmper() != SCORE_PARTID) {
-            auto scrollView = getDocument()->getScrollViewStaves(part->getCmper());
+            auto scrollView = getDocumentRef().getScrollViewStaves(part->getCmper());
             for (const auto& next : scrollView) {
                 if (next->staffId == this->getCmper()) {
                     return part;
@@ -1213,7 +1234,7 @@ void StaffComposite::applyStyle(const MusxInstance<StaffStyle>& staffStyle)
 
 MusxInstance<Staff> StaffComposite::getRawStaff() const
 {
-    auto result = getDocument()->getOthers()->get<Staff>(getRequestedPartId(), getCmper());
+    auto result = getDocumentRef().getOthers()->get<Staff>(getRequestedPartId(), getCmper());
     if (!result) {
         MUSX_INTEGRITY_ERROR("Unable to load staff " + std::to_string(getCmper()) + " from StaffComposite.");
     }
@@ -1278,7 +1299,7 @@ MusxInstanceList<StaffStyle> StaffStyle::findAllOverlappingStyles(const Document
 
 MusxInstance<others::StaffStyle> others::StaffStyleAssign::getStaffStyle() const
 {
-    auto result = getDocument()->getOthers()->get<others::StaffStyle>(getRequestedPartId(), styleId);
+    auto result = getDocumentRef().getOthers()->get<others::StaffStyle>(getRequestedPartId(), styleId);
     if (!result) {
         MUSX_INTEGRITY_ERROR("Staff style assignment has invalid staff style ID " + std::to_string(styleId)
             + ": Part " + std::to_string(getRequestedPartId())
@@ -30,6 +30,7 @@
 
 #include "BaseClasses.h"
 #include "CommonClasses.h"
+#include "InstrumentUuids.h"
  // do not add other dom class dependencies. Use .cpp files for implementations that need total class access.
 
 namespace musx {
@@ -306,6 +307,10 @@ public:
     /// @brief Returns the @ref MultiStaffInstrumentGroup for this staff if it is part of one in the data. Otherwise nullptr.
     MusxInstance<MultiStaffInstrumentGroup> getMultiStaffInstGroup() const;
 
+    /// @brief Returns the interned id of #instUuid. (See #dom::calcInstrumentId.)
+    [[nodiscard]]
+    InstrumentId calcInstrumentId() const { return dom::calcInstrumentId(instUuid); }
+
     /// @brief Returns the @ref details::StaffGroup for this staff if it is part of a multistaff instrument (as defined in #Document::getInstruments).
     /// @param forPartId The part id to use.
     MusxInstance<details::StaffGroup> getMultiStaffInstVisualGroup(Cmper forPartId) const;
@@ -691,8 +696,8 @@ public:
     {
         if (!masks) {
             // Finale allows creation of staff styles with no masks, so this is just a verbose comment
-            util::Logger::log(util::Logger::LogLevel::Verbose, "StaffStyle " + styleName
-                + " (" + std::to_string(getCmper()) + ") does not override anything.");
+            util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "StaffStyle " + styleName
+                + " (" + std::to_string(getCmper()) + ") does not override anything."; });
             createMasks(ptrToThis);
         }
         if (useNoteFont && !masks->floatNoteheadFont && !noteFont) {
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdlib>
 #include <cctype>
@@ -52,6 +53,18 @@ bool isLyricsWhitespace(unsigned char value)
     return value == 0x01 || value == 0x06 || (value < 128 && std::isspace(value) != 0);
 }
 
+bool isSameEnigmaStyles(const util::EnigmaStyles& a, const util::EnigmaStyles& b)
+{
+    if (a.categoryFont != b.categoryFont || a.baseline != b.baseline || a.superscript != b.superscript || a.tracking != b.tracking) {
+        return false;
+    }
+    if (!a.font || !b.font) {
+        return a.font == b.font;
+    }
+    // Interned styles are handed back to callers, so they must keep the exact font id that was parsed.
+    return a.font->fontId == b.font->fontId && a.font->isSame(*b.font);
+}
+
 } // namespace
 
 // **************************
@@ -61,7 +74,8 @@ bool isLyricsWhitespace(unsigned char value)
 void LyricsTextBase::createSyllableInfo(const MusxInstance<TextsBase>& ptrToThis)
 {
     std::string current;
-    std::vector<LyricsSyllableInfo::StyleSpan> currentEnigmaStyles;
+    size_t currentStart = 0;
+    size_t textSize = 0;
     bool inSeparator = false;
     bool currSeparatorHasHyphen = false;
     bool lastSeparatorHadHyphen = false;
@@ -69,18 +83,42 @@ void LyricsTextBase::createSyllableInfo(const MusxInstance<TextsBase>& ptrToThis
     int underscores = 0;
 
     const bool stripUnderscores = [&]() {
-        if (auto lyricOptions = getDocument()->getOptions()->get<options::LyricOptions>()) {
+        if (auto lyricOptions = getDocumentRef().getOptions()->get<options::LyricOptions>()) {
             return lyricOptions->useSmartWordExtensions;
         }
         return false;
     }();
 
     syllables.clear();
+    m_styleRuns.clear();
     m_syllableStyles.clear();
+
+    const auto internStyles = [&](const util::EnigmaStyles& styles) -> size_t {
+        for (size_t x = 0; x < m_syllableStyles.size(); x++) {
+            if (isSameEnigmaStyles(m_syllableStyles[x], styles)) {
+                return x;
+            }
+        }
+        m_syllableStyles.push_back(styles.createDeepCopy());
+        return m_syllableStyles.size() - 1;
+    };
+
+    // The syllables are built in one block, and #syllables holds aliasing pointers into it.
+    std::vector<LyricsSyllableInfo> syllableInfo;
+    const auto addSyllable = [&]() {
+        syllableInfo.push_back(LyricsSyllableInfo(std::move(current), currentStart, lastSeparatorHadHyphen, currSeparatorHasHyphen, underscores));
+        current.clear();
+        currentStart = textSize;
+    };
+
     auto parsingContext = getRawTextCtx(ptrToThis, SCORE_PARTID);
     parsingContext.parseEnigmaText([&](const std::string& nextChunk, const util::EnigmaStyles& styles) -> bool {
-        m_syllableStyles.push_back(styles.createDeepCopy());
-        currentEnigmaStyles.push_back({ current.size(), current.size(), m_syllableStyles.size() - 1 });
+        const size_t styleIndex = internStyles(styles);
+        if (!m_styleRuns.empty() && m_styleRuns.back().start == textSize) {
+            m_styleRuns.back().styleIndex = styleIndex; // the previous run never received any text
+        } else if (m_styleRuns.empty() || m_styleRuns.back().styleIndex != styleIndex) {
+            m_styleRuns.push_back({ textSize, styleIndex });
+        }
         for (auto c : nextChunk) {
             const unsigned char uc = static_cast<unsigned char>(c);
             if (c == '-' || isLyricsWhitespace(uc) || (stripUnderscores && c == '_')) {
@@ -103,10 +141,7 @@ void LyricsTextBase::createSyllableInfo(const MusxInstance<TextsBase>& ptrToThis
             } else {
                 if (inSeparator) {
                     if (!current.empty()) {
-                        syllables.push_back(MusxInstance<LyricsSyllableInfo>(new  LyricsSyllableInfo(getDocument(), current, lastSeparatorHadHyphen, currSeparatorHasHyphen, underscores, std::move(currentEnigmaStyles))));
-                        current.clear();
-                        currentEnigmaStyles.clear();
-                        currentEnigmaStyles.push_back({ current.size(), current.size(), m_syllableStyles.size() - 1 });
+                        addSyllable();
                     }
                     lastSeparatorHadHyphen = currSeparatorHasHyphen;
                     currSeparatorHasHyphen = false;
@@ -115,43 +150,35 @@ void LyricsTextBase::createSyllableInfo(const MusxInstance<TextsBase>& ptrToThis
                     underscores = 0;
                 }
                 current += c;
-                currentEnigmaStyles.back().end++;
+                textSize++;
             }
         }
         return true;
     });
 
     if (!current.empty()) {
-        syllables.push_back(MusxInstance<LyricsSyllableInfo>(new  LyricsSyllableInfo(getDocument(), current, lastSeparatorHadHyphen, currSeparatorHasHyphen, underscores, std::move(currentEnigmaStyles))));
+        addSyllable();
+    }
+
+    if (!syllableInfo.empty()) {
+        const auto block = std::make_shared<const std::vector<LyricsSyllableInfo>>(std::move(syllableInfo));
+        syllables.reserve(block->size());
+        for (const auto& syllable : *block) {
+            syllables.emplace_back(block, &syllable);
+        }
     }
 }
 
+std::string_view LyricsTextBase::getSyllableText(size_t syllableIndex) const
+{
+    return syllables.at(syllableIndex)->syllable;
+}
+
 bool LyricsTextBase::iterateStylesForSyllable(size_t syllableIndex, util::EnigmaString::TextChunkCallback callback) const
 {
-    if (syllableIndex >= syllables.size()) {
-        return false;
-    }
-    const auto& syllable = syllables[syllableIndex];
-    for (const auto& span : syllable->m_enigmaStyleMap) {
-        MUSX_ASSERT_IF(span.start > syllable->syllable.size() || span.end > syllable->syllable.size()) {
-            throw std::logic_error("syllable's enigmaStyles map contained out-of-range start or end values.");
-        }
-        MUSX_ASSERT_IF(span.start > span.end) {
-            throw std::logic_error("syllable's enigmaStyles map contained start value greater than end value.");
-        }
-        if (span.start == syllable->syllable.size()) {
-            continue;
-        }
-        MUSX_ASSERT_IF(span.styleIndex >= m_syllableStyles.size()) {
-            throw std::logic_error("syllable's enigmaStyles map contained out-of-range styleIndex.");
-        }
-        std::string_view segment(syllable->syllable.data() + span.start, span.end - span.start);
-        const auto& style = m_syllableStyles.at(span.styleIndex);
-        if (!callback(std::string(segment), style)) {
-            return false;
-        }
-    }
-    return true;
+    return iterateStyleSpansForSyllable(syllableIndex, [&](std::string_view chunk, const util::EnigmaStyles& styles) {
+        return callback(std::string(chunk), styles);
+    });
 }
 
 } // namespace texts
@@ -21,7 +21,10 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -124,7 +127,13 @@ class LyricsTextBase : public TextsBase
 public:
     using TextsBase::TextsBase;
 
-    std::vector<std::shared_ptr<const LyricsSyllableInfo>> syllables; ///< the syllable info for the lyric text, constructed by the factory
+    std::vector<MusxInstance<LyricsSyllableInfo>> syllables; ///< the syllable info for the lyric text, constructed by the factory
+
+    /// @brief Returns the text of a syllable with no hyphenation or font information.
+    /// @param syllableIndex The 0-based index of the syllable in #syllables.
+    /// @return A view of the syllable's text. It is valid as long as the syllable it came from.
+    /// @throws std::out_of_range if @p syllableIndex is out of range.
+    std::string_view getSyllableText(size_t syllableIndex) const;
 
     /// @brief Parse a given syllable into chunks with EnigmaStyles for that chunk. In the most common case, the callback is called exactly once.
     /// However, this design allows for detecting uncommon cases of style changes within a syllable.
@@ -133,12 +142,60 @@ public:
     /// @return True if the syllable was fully parsed. False if @p syllableIndex was out of range or if parsing was aborted by the callback function.
     bool iterateStylesForSyllable(size_t syllableIndex, util::EnigmaString::TextChunkCallback callback) const;
 
+    /// @brief Same as #iterateStylesForSyllable, but passes each chunk as a view into the syllable text rather than a copy.
+    /// @tparam Callback A callable with the signature `bool(std::string_view text, const util::EnigmaStyles& styles)`.
+    /// @param syllableIndex The 0-based index of the syllable in #syllables.
+    /// @param callback The callback for each chunk of syllable with a different style.
+    /// @return True if the syllable was fully parsed. False if @p syllableIndex was out of range or if parsing was aborted by the callback function.
+    template <typename Callback>
+    bool iterateStyleSpansForSyllable(size_t syllableIndex, Callback&& callback) const
+    {
+        if (syllableIndex >= syllables.size()) {
+            return false;
+        }
+        const auto& syllable = syllables[syllableIndex];
+        const std::string_view syllableText = syllable->syllable;
+        const size_t syllableStart = syllable->m_textOffset;
+        const size_t syllableEnd = syllableStart + syllableText.size();
+        // find the last run that starts at or before the syllable
+        auto run = std::upper_bound(m_styleRuns.begin(), m_styleRuns.end(), syllableStart,
+            [](size_t offset, const StyleRun& styleRun) { return offset < styleRun.start; });
+        MUSX_ASSERT_IF(run == m_styleRuns.begin()) {
+            throw std::logic_error("syllable has no style run.");
+        }
+        for (--run; run != m_styleRuns.end() && run->start < syllableEnd; ++run) {
+            MUSX_ASSERT_IF(run->styleIndex >= m_syllableStyles.size()) {
+                throw std::logic_error("syllable style run contained out-of-range styleIndex.");
+            }
+            const size_t start = (std::max)(run->start, syllableStart);
+            const auto next = std::next(run);
+            const size_t end = next == m_styleRuns.end() ? syllableEnd : (std::min)(next->start, syllableEnd);
+            if (start == end) {
+                continue;
+            }
+            if (!callback(syllableText.substr(start - syllableStart, end - start), m_syllableStyles[run->styleIndex])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// @brief Creates the syllables array. Used by the factory but available at any time.
     /// @param ptrToThis MusxInstance ptr to this (to avoid need for shared_for_this)
     void createSyllableInfo(const MusxInstance<TextsBase>& ptrToThis);
 
 private:
-    std::vector<util::EnigmaStyles> m_syllableStyles; ///< the list of font styles in this text.
+    /// @brief A run of syllable text with a single style. The run extends to the start of the next run.
+    ///
+    /// Offsets count the bytes of every syllable's text in order, as if the syllables were concatenated.
+    struct StyleRun
+    {
+        size_t start;       ///< start byte of the run
+        size_t styleIndex;  ///< index into #m_syllableStyles
+    };
+
+    std::vector<StyleRun> m_styleRuns;                  ///< style runs over the syllable text, in ascending order of start byte.
+    std::vector<util::EnigmaStyles> m_syllableStyles;   ///< the distinct font styles in this text.
 };
 
 /**
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/dom/TieGraph.h"
+
+#include <optional>
+
+#include "musx/musx.h"
+
+namespace musx {
+namespace dom {
+
+TieGraph::TieGraph(const DocumentPtr& document, Cmper partId)
+{
+    document->iterateEntries(partId, [&](const EntryInfoPtr& entryInfo) {
+        const auto entry = entryInfo->getEntry();
+        if (!entry->isNote) {
+            return true;
+        }
+
+        // tie starts: each is resolved forward exactly once
+        for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+            NoteInfoPtr noteInfo(entryInfo, noteIndex);
+            if (noteInfo->tieStart) {
+                if (auto tiedTo = noteInfo.calcTieTo()) {
+                    addLink(noteInfo, tiedTo, LinkType::Tie);
+                    continue;
+                }
+            }
+            if (entry->notes.size() == 1) {
+                if (const auto arpeggiatedTie = noteInfo.calcArpeggiatedTieInfo()) {
+                    if (NoteInfoPtr target(arpeggiatedTie->targetEntry, arpeggiatedTie->targetNoteIndex); target) {
+                        addLink(noteInfo, target, LinkType::ArpeggiatedTie);
+                    }
+                }
+            }
+        }
+
+        // tie ends: the stand-in tie end is an entry-level match that applies to every note without a real tie end
+        std::optional<bool> hasPseudoTieEnd;
+        for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+            NoteInfoPtr noteInfo(entryInfo, noteIndex);
+            if (noteInfo->tieEnd || m_tieFrom.find(makeKey(entry->getEntryNumber(), noteInfo->getNoteId())) != m_tieFrom.end()) {
+                continue;
+            }
+            if (!hasPseudoTieEnd) {
+                hasPseudoTieEnd = bool(noteInfo.calcPseudoTieEndInfo());
+            }
+            if (!*hasPseudoTieEnd) {
+                break;
+            }
+            if (auto tiedFrom = noteInfo.calcTieFrom(/*requireTie*/ false)) {
+                if (!getTieTo(tiedFrom)) {
+                    addLink(tiedFrom, noteInfo, LinkType::PseudoTieEnd);
+                }
+            }
+        }
+
+        // jump ties can only land on the first entry of a measure
+        if (entryInfo->elapsedDuration == 0) {
+            for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+                NoteInfoPtr noteInfo(entryInfo, noteIndex);
+                if (!noteInfo->tieEnd && hasPseudoTieEnd.has_value() && !*hasPseudoTieEnd) {
+                    continue;
+                }
+                for (const auto& [tiedFrom, direction] : noteInfo.calcJumpTieContinuationsFrom()) {
+                    addLink(tiedFrom, noteInfo, LinkType::JumpTie);
+                }
+            }
+        }
+        return true;
+    });
+}
+
+TieGraph::NoteKey TieGraph::NoteKey::fromNoteInfo(const NoteInfoPtr& noteInfo)
+{
+    const auto& entryInfo = noteInfo.getEntryInfo();
+    return { entryInfo->getEntry()->getEntryNumber(), noteInfo->getNoteId(),
+        entryInfo.getStaff(), entryInfo.getMeasure(), entryInfo.getLayerIndex() };
+}
+
+NoteInfoPtr TieGraph::NoteKey::calcNoteInfo(EntryInfoResolver& resolver) const
+{
+    const auto frame = resolver.getFrame(staffId, measureId, layerIndex);
+    if (!frame) {
+        return {};
+    }
+    const auto& entries = frame->getEntries();
+    for (size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++) {
+        const auto entry = entries[entryIndex]->getEntry();
+        if (entry->getEntryNumber() != entryNumber) {
+            continue;
+        }
+        for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+            if (entry->notes[noteIndex]->getNoteId() == noteId) {
+                return NoteInfoPtr(EntryInfoPtr(frame, entryIndex), noteIndex);
+            }
+        }
+        break;
+    }
+    return {};
+}
+
+void TieGraph::addLink(const NoteInfoPtr& from, const NoteInfoPtr& to, LinkType type)
+{
+    Link link{ NoteKey::fromNoteInfo(from), NoteKey::fromNoteInfo(to), type };
+    if (type == LinkType::JumpTie) {
+        m_jumpTiesFrom[makeKey(link.to)].push_back(link);
+        return;
+    }
+    // the sweep runs forward, so a later tie start is the nearer one, which is what NoteInfoPtr::calcTieFrom finds
+    m_tieFrom.insert_or_assign(makeKey(link.to), link);
+    m_tieTo.emplace(makeKey(link.from), link);
+}
+
+const TieGraph::Link* TieGraph::getTieTo(EntryNumber entryNumber, NoteNumber noteId) const
+{
+    const auto it = m_tieTo.find(makeKey(entryNumber, noteId));
+    return it != m_tieTo.end() ? &it->second : nullptr;
+}
+
+const TieGraph::Link* TieGraph::getTieTo(const NoteInfoPtr& noteInfo) const
+{
+    return noteInfo ? getTieTo(noteInfo.getEntryInfo()->getEntry()->getEntryNumber(), noteInfo->getNoteId()) : nullptr;
+}
+
+const TieGraph::Link* TieGraph::getTieFrom(EntryNumber entryNumber, NoteNumber noteId) const
+{
+    const auto it = m_tieFrom.find(makeKey(entryNumber, noteId));
+    return it != m_tieFrom.end() ? &it->second : nullptr;
+}
+
+const TieGraph::Link* TieGraph::getTieFrom(const NoteInfoPtr& noteInfo) const
+{
+    return noteInfo ? getTieFrom(noteInfo.getEntryInfo()->getEntry()->getEntryNumber(), noteInfo->getNoteId()) : nullptr;
+}
+
+const std::vector<TieGraph::Link>& TieGraph::getJumpTiesFrom(EntryNumber entryNumber, NoteNumber noteId) const
+{
+    static const std::vector<Link> empty;
+    const auto it = m_jumpTiesFrom.find(makeKey(entryNumber, noteId));
+    return it != m_jumpTiesFrom.end() ? it->second : empty;
+}
+
+size_t TieGraph::getLinkCount() const
+{
+    size_t result = m_tieTo.size();
+    for (const auto& [key, links] : m_jumpTiesFrom) {
+        result += links.size();
+    }
+    return result;
+}
+
+} // namespace dom
+} // namespace musx
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Entries.h"
+
+namespace musx {
+namespace dom {
+
+/**
+ * @class TieGraph
+ * @brief Document-wide graph of tie links between notes for a score or linked part.
+ *
+ * The graph is built in a single forward sweep over the entries of every staff and layer. Each note that starts a tie
+ * is resolved to its tie-to note once, and the tie-from direction is recorded as the inverse of the same link, so the
+ * backward searches performed by @ref NoteInfoPtr::calcTieFrom are never needed. The sweep also records stand-in ties:
+ * arpeggiated ties (@ref NoteInfoPtr::calcArpeggiatedTieInfo), pseudo tie ends (@ref NoteInfoPtr::calcPseudoTieEndInfo),
+ * and jump ties into the first entry of a measure (@ref NoteInfoPtr::calcJumpTieContinuationsFrom).
+ * Pseudo laissez-vibrer ties have no target note and are not part of the graph.
+ *
+ * Lookups are O(1) by entry number and note id. The links identify notes by value (see #NoteKey), so the graph holds no
+ * entry frames and can be shared between threads. Use #NoteKey::calcNoteInfo to obtain a @ref NoteInfoPtr for a note.
+ *
+ * This is not a Finale data class. Obtain it with @ref Document::getTieGraph, which builds it on first use.
+ */
+class TieGraph
+{
+public:
+    /// @enum LinkType
+    /// @brief The source of a tie link.
+    enum class LinkType
+    {
+        Tie,            ///< A tie started by @ref Note::tieStart. The target's @ref Note::tieEnd may still be false.
+        ArpeggiatedTie, ///< A smart shape acting as an arpeggiated tie.
+        PseudoTieEnd,   ///< A stand-in tie end on a note that has no @ref Note::tieEnd.
+        JumpTie         ///< A tie that continues into the first entry of a measure across a repeat or jump.
+    };
+
+    /// @brief Identifies a note in the graph along with the entry frame it was found in.
+    struct NoteKey
+    {
+        EntryNumber entryNumber{};  ///< The entry that contains the note.
+        NoteNumber noteId{};        ///< The @ref Note::getNoteId value of the note.
+        StaffCmper staffId{};       ///< The staff of the entry frame that contains the note.
+        MeasCmper measureId{};      ///< The measure of the entry frame that contains the note.
+        LayerIndex layerIndex{};    ///< The layer of the entry frame that contains the note.
+
+        /// @brief Creates the key for a note.
+        [[nodiscard]]
+        static NoteKey fromNoteInfo(const NoteInfoPtr& noteInfo);
+
+        /// @brief Finds the note in the entry frame it was found in.
+        /// @param resolver The resolver to build the frame with. Its part must be the part of the graph.
+        /// @return The note or null if it is no longer in its frame.
+        [[nodiscard]]
+        NoteInfoPtr calcNoteInfo(EntryInfoResolver& resolver) const;
+
+        /// @brief Returns true if the keys identify the same note in the same frame.
+        bool operator==(const NoteKey& other) const
+        {
+            return entryNumber == other.entryNumber && noteId == other.noteId && staffId == other.staffId
+                && measureId == other.measureId && layerIndex == other.layerIndex;
+        }
+
+        /// @brief Returns true if the keys differ.
+        bool operator!=(const NoteKey& other) const { return !(*this == other); }
+    };
+
+    /// @brief A single link from a tied-from note to a tied-to note.
+    struct Link
+    {
+        NoteKey from;                   ///< The note the tie starts on.
+        NoteKey to;                     ///< The note the tie ends on.
+        LinkType type{ LinkType::Tie }; ///< The source of the link.
+    };
+
+    /// @brief Builds the graph for a score or linked part.
+    /// @param document The document to index.
+    /// @param partId The score or linked part to index.
+    TieGraph(const DocumentPtr& document, Cmper partId);
+
+    /// @brief Returns the link that starts on a note, or nullptr if the note does not tie forward.
+    /// @param entryNumber The entry that contains the note.
+    /// @param noteId The @ref Note::getNoteId value of the note.
+    [[nodiscard]]
+    const Link* getTieTo(EntryNumber entryNumber, NoteNumber noteId) const;
+
+    /// @brief Returns the link that starts on a note, or nullptr if the note does not tie forward.
+    [[nodiscard]]
+    const Link* getTieTo(const NoteInfoPtr& noteInfo) const;
+
+    /// @brief Returns the link that ends on a note from the preceding notes in its layer, or nullptr if there is none.
+    /// Jump ties are returned by #getJumpTiesFrom instead.
+    /// @param entryNumber The entry that contains the note.
+    /// @param noteId The @ref Note::getNoteId value of the note.
+    [[nodiscard]]
+    const Link* getTieFrom(EntryNumber entryNumber, NoteNumber noteId) const;
+
+    /// @brief Returns the link that ends on a note from the preceding notes in its layer, or nullptr if there is none.
+    [[nodiscard]]
+    const Link* getTieFrom(const NoteInfoPtr& noteInfo) const;
+
+    /// @brief Returns the jump ties that end on a note, one for each measure that jumps to the note's measure.
+    /// @param entryNumber The entry that contains the note.
+    /// @param noteId The @ref Note::getNoteId value of the note.
+    /// @return The links, which are empty if none.
+    [[nodiscard]]
+    const std::vector<Link>& getJumpTiesFrom(EntryNumber entryNumber, NoteNumber noteId) const;
+
+    /// @brief Returns the number of links in the graph, including jump ties.
+    [[nodiscard]]
+    size_t getLinkCount() const;
+
+private:
+    static uint64_t makeKey(EntryNumber entryNumber, NoteNumber noteId)
+    { return (uint64_t(uint32_t(entryNumber)) << 16) | noteId; }
+
+    static uint64_t makeKey(const NoteKey& noteKey)
+    { return makeKey(noteKey.entryNumber, noteKey.noteId); }
+
+    void addLink(const NoteInfoPtr& from, const NoteInfoPtr& to, LinkType type);
+
+    std::unordered_map<uint64_t, Link> m_tieTo;                       ///< keyed by the tied-from note
+    std::unordered_map<uint64_t, Link> m_tieFrom;                     ///< keyed by the tied-to note
+    std::unordered_map<uint64_t, std::vector<Link>> m_jumpTiesFrom;   ///< keyed by the tied-to note
+};
+
+} // namespace dom
+} // namespace musx
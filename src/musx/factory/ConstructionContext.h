@@ -1,8 +1,10 @@
 #pragma once
 
+#include <memory>
 #include <set>
 
 #include "musx/dom/DocumentElement.h"
+#include "musx/factory/LoadProfile.h"
 
 namespace musx {
 namespace factory {
@@ -19,7 +21,11 @@ public:
         }
     }
 
+    /// @brief Returns the profile being recorded for this construction, or nullptr if profiling was not requested.
+    [[nodiscard]] LoadProfile* getLoadProfile() const { return m_loadProfile.get(); }
+
 private:
+    friend class DocumentFactory;
     friend void resolveFontDefinitions(const dom::DocumentPtr&, const ConstructionContext&);
 
     /// @brief Returns all non-default font definition IDs referenced during construction.
@@ -27,6 +33,7 @@ private:
     [[nodiscard]] std::set<dom::Cmper>& referencedFontIds() { return m_referencedFontIds; }
 
     std::set<dom::Cmper> m_referencedFontIds;
+    std::shared_ptr<LoadProfile> m_loadProfile;
 };
 
 } // namespace factory
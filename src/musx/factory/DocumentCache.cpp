@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/factory/DocumentCache.h"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+
+namespace musx {
+namespace factory {
+
+dom::DocumentPtr DocumentCache::getFile(const std::filesystem::path& path,
+    const std::function<dom::DocumentPtr(const std::filesystem::path&)>& load)
+{
+    const auto size = static_cast<size_t>(std::filesystem::file_size(path));
+    const auto modified = std::filesystem::last_write_time(path).time_since_epoch().count();
+    const std::string key = "file:" + std::filesystem::absolute(path).lexically_normal().string()
+        + ":" + std::to_string(size) + ":" + std::to_string(modified);
+    return getOrCreate(key, size, [&]() { return load(path); });
+}
+
+dom::DocumentPtr DocumentCache::getOrCreate(const std::string& key, size_t cost,
+    const std::function<dom::DocumentPtr()>& create)
+{
+    std::promise<dom::DocumentPtr> promise;
+    std::shared_future<dom::DocumentPtr> document;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto it = m_entries.find(key); it != m_entries.end()) {
+            m_statistics.hits++;
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+            document = it->second.document;
+        } else {
+            m_statistics.misses++;
+            document = promise.get_future().share();
+            generation = ++m_nextGeneration;
+            m_lru.push_front(key);
+            m_entries.emplace(key, Entry{ document, cost, generation, m_lru.begin() });
+            m_statistics.totalBytes += cost;
+            evictOverBudget();
+        }
+    }
+    if (generation == 0) {
+        return document.get(); // waits for an in-flight load and rethrows its failure
+    }
+
+    try {
+        promise.set_value(create());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        evictOverBudget(); // entries skipped while this one was loading
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto it = m_entries.find(key); it != m_entries.end() && it->second.generation == generation) {
+            m_statistics.totalBytes -= it->second.cost;
+            m_lru.erase(it->second.lruPosition);
+            m_entries.erase(it);
+        }
+    }
+    return document.get();
+}
+
+void DocumentCache::evictOverBudget()
+{
+    // Never evict the most recent entry, even if it alone exceeds the budget. Entries that are still loading are
+    // skipped, because other requests may be waiting on them; they are reconsidered once their load finishes.
+    for (auto lruIt = m_lru.end(); m_statistics.totalBytes > m_byteBudget && lruIt != m_lru.begin();) {
+        if (--lruIt == m_lru.begin()) {
+            break;
+        }
+        auto it = m_entries.find(*lruIt);
+        if (it->second.document.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+        m_statistics.totalBytes -= it->second.cost;
+        m_statistics.evictions++;
+        m_entries.erase(it);
+        lruIt = m_lru.erase(lruIt);
+    }
+}
+
+DocumentCache::Statistics DocumentCache::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics result = m_statistics;
+    result.entryCount = m_entries.size();
+    return result;
+}
+
+void DocumentCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+    m_statistics = {};
+}
+
+} // namespace factory
+} // namespace musx
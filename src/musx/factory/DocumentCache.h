@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "musx/dom/Document.h"
+#include "musx/factory/DocumentFactory.h"
+#include "musx/util/ContentHash.h"
+
+namespace musx {
+namespace factory {
+
+/**
+ * @brief A thread-safe cache of finalized documents keyed by the content they were created from.
+ *
+ * Requests for content that has been loaded before return the same #dom::DocumentPtr. Concurrent requests for
+ * content that is still loading wait for the first load rather than starting their own. Cached documents are
+ * shared by every caller and must be treated as read-only.
+ *
+ * Each entry is charged the byte size of its source. Once the total exceeds the byte budget, the least recently
+ * used entries are evicted. Evicting an entry only drops the cache's reference; callers still holding the
+ * document are unaffected.
+ */
+class DocumentCache
+{
+public:
+    /// @brief Counters describing cache activity since construction or the last #clear.
+    struct Statistics
+    {
+        size_t hits{};          ///< Requests satisfied by a cached or in-flight document.
+        size_t misses{};        ///< Requests that created a document.
+        size_t evictions{};     ///< Entries evicted to stay within the byte budget.
+        size_t entryCount{};    ///< Entries currently cached.
+        size_t totalBytes{};    ///< Bytes currently charged to cached entries.
+    };
+
+    /// @brief Constructor
+    /// @param byteBudget The total source bytes the cache may hold before evicting entries.
+    explicit DocumentCache(size_t byteBudget) : m_byteBudget(byteBudget) {}
+
+    /**
+     * @brief Returns the document for an EnigmaXML buffer, creating it on the first request.
+     *
+     * The key is the content hash and size of the buffer plus the options that affect the result
+     * (part voicing policy and notation metadata). Embedded graphics and the source path are not part of the key.
+     * @tparam XmlDocumentType The xml backend used on a miss.
+     * @throws Any exception thrown by #DocumentFactory::create. Failed loads are not cached.
+     */
+    template <typename XmlDocumentType>
+    [[nodiscard]] dom::DocumentPtr get(const char* data, size_t size, DocumentFactory::CreateOptions&& createOptions = {})
+    {
+        const auto& metadata = createOptions.getNotationMetadata();
+        const std::string key = "xml:" + std::to_string(util::hashContent(data, size))
+            + ":" + std::to_string(size)
+            + ":" + std::to_string(static_cast<int>(createOptions.partVoicingPolicy))
+            + ":" + std::to_string(util::hashContent(metadata.data(), metadata.size()));
+        return getOrCreate(key, size, [&]() {
+            return DocumentFactory::create<XmlDocumentType>(data, size, std::move(createOptions));
+        });
+    }
+
+    /// @brief Returns the document for an EnigmaXML buffer held in a byte container. See #get.
+    template <typename XmlDocumentType, typename Container, typename = DocumentFactory::IsCharContainer<Container>>
+    [[nodiscard]] dom::DocumentPtr get(const Container& xmlBuffer, DocumentFactory::CreateOptions&& createOptions = {})
+    {
+        return get<XmlDocumentType>(reinterpret_cast<const char*>(xmlBuffer.data()), xmlBuffer.size(), std::move(createOptions));
+    }
+
+    /**
+     * @brief Returns the document for a file, keyed by its path, size, and modification time.
+     *
+     * This avoids reading and hashing the file on a hit. It is intended for `.musx` files, which the caller
+     * must unpack before calling #DocumentFactory::create.
+     * @param path The file.
+     * @param load Creates the document from @p path on a miss.
+     * @throws std::filesystem::filesystem_error if the file cannot be examined, or anything thrown by @p load.
+     */
+    [[nodiscard]] dom::DocumentPtr getFile(const std::filesystem::path& path,
+        const std::function<dom::DocumentPtr(const std::filesystem::path&)>& load);
+
+    /**
+     * @brief Returns the document cached for @p key, calling @p create on a miss.
+     * @param key The cache key. Keys from #get and #getFile are prefixed with `xml:` and `file:`.
+     * @param cost The number of bytes to charge against the budget.
+     * @param create Creates the document. It is called without the cache lock held.
+     */
+    [[nodiscard]] dom::DocumentPtr getOrCreate(const std::string& key, size_t cost,
+        const std::function<dom::DocumentPtr()>& create);
+
+    /// @brief Returns a consistent snapshot of the cache counters.
+    [[nodiscard]] Statistics getStatistics() const;
+
+    /// @brief Drops every cached entry and resets the counters.
+    void clear();
+
+private:
+    struct Entry
+    {
+        std::shared_future<dom::DocumentPtr> document;
+        size_t cost{};
+        uint64_t generation{};
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    void evictOverBudget();
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::list<std::string> m_lru;   ///< Keys of #m_entries, most recently used first.
+    size_t m_byteBudget;
+    uint64_t m_nextGeneration{};
+    Statistics m_statistics;
+};
+
+} // namespace factory
+} // namespace musx
@@ -22,10 +22,12 @@
 
 #include "musx/factory/DocumentFactory.h"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "musx/dom/Details.h"
 #include "musx/dom/Entries.h"
@@ -58,8 +60,8 @@ void resolveFontDefinitions(const dom::DocumentPtr& document, const Construction
         }
         font->name = "Missing Font (" + std::to_string(fontId) + ")";
         document->getOthers()->add(dom::others::FontDefinition::XmlNodeName, font);
-        util::Logger::log(util::Logger::LogLevel::Info, "Font " + std::to_string(fontId)
-            + " is referenced but not defined; it will show as \"" + font->name + "\".");
+        util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Font " + std::to_string(fontId)
+            + " is referenced but not defined; it will show as \"" + font->name + "\"."; });
     }
 }
 
@@ -101,8 +103,8 @@ void resolveExpressions(const dom::DocumentPtr& document)
         auto category = document->getOthers()->get<dom::others::MarkingCategory>(
             expression->getSourcePartId(), expression->categoryId);
         if (!category) {
-            util::Logger::log(util::Logger::LogLevel::Info, "Marking category for expression "
-                + std::to_string(expression->getCmper()) + " does not exist.");
+            util::Logger::log(util::Logger::LogLevel::Info, [&]() { return "Marking category for expression "
+                + std::to_string(expression->getCmper()) + " does not exist."; });
             continue;
         }
         auto* mutableCategory = const_cast<dom::others::MarkingCategory*>(category.get());
@@ -153,7 +155,7 @@ void resolveLayerAttributes(const dom::DocumentPtr& document)
             + " <layerAtts> elements. Got " + std::to_string(layers.size()) + ".");
     } else if (layers.size() > dom::MAX_LAYERS) {
         util::Logger::log(util::Logger::LogLevel::Verbose,
-            "Ignoring " + std::to_string(layers.size() - dom::MAX_LAYERS) + " extra <layerAtts> elements.");
+            [&]() { return "Ignoring " + std::to_string(layers.size() - dom::MAX_LAYERS) + " extra <layerAtts> elements."; });
     }
     for (size_t i = 0; i < dom::MAX_LAYERS; ++i) {
         if (layers[i]->getCmper() != i) {
@@ -212,8 +214,8 @@ void resolvePartDefinitions(const dom::DocumentPtr& document)
             partGlobals->scrollViewIUlist = dom::BASE_SYSTEM_ID;
             partGlobals->studioViewIUlist = dom::STUDIO_VIEW_SYSTEM_ID;
             document->getOthers()->add(dom::others::PartGlobals::XmlNodeName, partGlobals);
-            util::Logger::log(util::Logger::LogLevel::Verbose, "Part " + std::to_string(part->getCmper())
-                + " has no PartGlobals. A default PartGlobals was created.");
+            util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "Part " + std::to_string(part->getCmper())
+                + " has no PartGlobals. A default PartGlobals was created."; });
         }
     }
 }
@@ -259,13 +261,14 @@ void resolveStaffGroups(const dom::DocumentPtr& document)
             auto start = staves.getIndexForStaff(group->startInst);
             auto end = staves.getIndexForStaff(group->endInst);
             if (!start || !end) {
-                util::Logger::log(util::Logger::LogLevel::Verbose, "Group "
+                util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "Group "
                     + std::to_string(group->getCmper2()) + " in part " + part->getName()
                     + " [" + std::to_string(part->getCmper())
-                    + "] has non-existent start or end staff cmpers");
+                    + "] has non-existent start or end staff cmpers"; });
                 continue;
             }
             auto* mutableGroup = const_cast<dom::details::StaffGroup*>(group.get());
+            mutableGroup->staves.clear();
             for (size_t i = *start; i <= *end && i < staves.size(); ++i) {
                 mutableGroup->staves.insert(staves[i]->staffId);
             }
@@ -304,7 +307,8 @@ const std::vector<std::pair<std::string_view, Resolver>>& resolvers()
         {dom::others::MultiStaffGroupId::XmlNodeName, makeResolver(resolveMultiStaffGroupIds)},
         {dom::others::MultiStaffInstrumentGroup::XmlNodeName,
             makeResolver(resolveMultiStaffInstrumentGroups)},
-        {dom::others::Page::XmlNodeName, makeResolver(dom::others::Page::calcSystemInfo)},
+        {dom::others::Page::XmlNodeName,
+            makeResolver(static_cast<void(*)(const dom::DocumentPtr&)>(dom::others::Page::calcSystemInfo))},
         {dom::others::PartDefinition::XmlNodeName, makeResolver(resolvePartDefinitions)},
         {dom::details::SecondaryBeamAlterationsDownStem::XmlNodeName,
             makeResolver(resolveBeamAlterations<dom::details::SecondaryBeamAlterationsDownStem>)},
@@ -338,7 +342,9 @@ DocumentFactory::ConstructionSession DocumentFactory::begin(ConstructionOptions
     document->getDetails() = std::make_shared<dom::DetailsPool>(document);
     document->getEntries() = std::make_shared<dom::EntryPool>(document);
     document->getTexts() = std::make_shared<dom::TextsPool>(document);
-    return ConstructionSession(std::move(document));
+    ConstructionSession session(std::move(document));
+    session.m_context.m_loadProfile = std::move(options.profile);
+    return session;
 }
 
 DocumentFactory::ConstructionSession DocumentFactory::begin()
@@ -371,6 +377,7 @@ DocumentFactory::DocumentPtr DocumentFactory::createFromXmlRoot(
     auto session = begin(std::move(options));
     const auto& document = session.getDocument();
     for (auto element = root->getFirstChildElement(); element; element = element->getNextSibling()) {
+        LoadProfile::ScopedPhase phase(session.getConstructionContext().getLoadProfile(), "pool", element->getTagName());
         if (element->getTagName() == "header") {
             document->getHeader() = HeaderFactory::create(element);
         } else if (element->getTagName() == "options") {
@@ -390,21 +397,58 @@ DocumentFactory::DocumentPtr DocumentFactory::createFromXmlRoot(
 
 void DocumentFactory::finalize(const DocumentPtr& document, ConstructionContext& context)
 {
-    document->getOptions()->integrityCheckAll();
-    document->getOthers()->integrityCheckAll();
-    document->getDetails()->integrityCheckAll();
-    document->getEntries()->integrityCheckAll();
-    document->getTexts()->integrityCheckAll();
+    using ScopedPhase = LoadProfile::ScopedPhase;
+    LoadProfile* profile = context.getLoadProfile();
+    {
+        ScopedPhase phase(profile, "integrity", "options");
+        document->getOptions()->integrityCheckAll();
+    }
+    {
+        ScopedPhase phase(profile, "integrity", "others");
+        document->getOthers()->integrityCheckAll();
+    }
+    {
+        ScopedPhase phase(profile, "integrity", "details");
+        document->getDetails()->integrityCheckAll();
+    }
+    {
+        ScopedPhase phase(profile, "integrity", "entries");
+        document->getEntries()->integrityCheckAll();
+    }
+    {
+        ScopedPhase phase(profile, "integrity", "texts");
+        document->getTexts()->integrityCheckAll();
+    }
+    {
+        ScopedPhase phase(profile, "sortedTuplets");
+        document->createSortedTupletMap(); // before the resolvers, which may create entry frames
+    }
 
 #ifdef MUSX_DISPLAY_NODE_NAMES
     util::Logger::log(util::Logger::LogLevel::Verbose, "============");
 #endif
     for (const auto& [key, resolver] : resolvers()) {
-        (void)key;
+        ScopedPhase phase(profile, "resolver", key);
         resolver(document, context);
     }
-    document->m_instruments = document->createInstrumentMap(dom::SCORE_PARTID);
-    document->createRehearsalMarkMap();
+    {
+        ScopedPhase phase(profile, "instruments");
+        document->m_instruments = document->createInstrumentMap(dom::SCORE_PARTID);
+    }
+    {
+        ScopedPhase phase(profile, "partMembership");
+        document->createPartMembershipTable();
+    }
+    {
+        ScopedPhase phase(profile, "rehearsalMarks");
+        document->createRehearsalMarkMap();
+    }
+    ScopedPhase phase(profile, "blankPages");
+    calcLeadingBlankPages(document);
+}
+
+void DocumentFactory::calcLeadingBlankPages(const DocumentPtr& document)
+{
     document->m_maxBlankPages = 0;
     for (const auto& part : document->getOthers()->getArray<dom::others::PartDefinition>(dom::SCORE_PARTID)) {
         auto* mutablePart = const_cast<dom::others::PartDefinition*>(part.get());
@@ -420,5 +464,121 @@ void DocumentFactory::finalize(const DocumentPtr& document, ConstructionContext&
     }
 }
 
+void DocumentFactory::refresh(const DocumentPtr& document)
+{
+    using Kind = dom::EditScope::Kind;
+    const auto scopes = std::exchange(document->m_dirtyScopes, {});
+    const auto hasKind = [&](Kind kind) {
+        return std::any_of(scopes.begin(), scopes.end(), [kind](const dom::EditScope& scope) { return scope.kind == kind; });
+    };
+
+    std::vector<dom::Cmper> allPartIds;
+    for (const auto& part : document->getOthers()->getArray<dom::others::PartDefinition>(dom::SCORE_PARTID)) {
+        allPartIds.push_back(part->getCmper());
+    }
+    if (std::find(allPartIds.begin(), allPartIds.end(), dom::SCORE_PARTID) == allPartIds.end()) {
+        allPartIds.insert(allPartIds.begin(), dom::SCORE_PARTID); // score data exists even without a score part definition
+    }
+
+    // The resolvers only add derived values, so the values an edit can make stale are cleared before they run again.
+    // Staves come first, because the part membership table decides which parts the other scopes affect.
+    if (hasKind(Kind::Staves)) {
+        for (const dom::Cmper partId : allPartIds) {
+            for (const auto& staff : document->getOthers()->getArray<dom::others::Staff>(partId)) {
+                const_cast<dom::others::Staff*>(staff.get())->multiStaffInstId = 0;
+            }
+            for (const auto& group : document->getDetails()->getArray<dom::details::StaffGroup>(partId, document->calcScrollViewCmper(partId))) {
+                const_cast<dom::details::StaffGroup*>(group.get())->multiStaffGroupId = 0;
+            }
+        }
+        resolveMultiStaffGroupIds(document);
+        resolveMultiStaffInstrumentGroups(document);
+        resolveStaff(document);
+        resolveStaffGroups(document);
+        resolveStaffStyles(document);
+        document->m_instruments = document->createInstrumentMap(dom::SCORE_PARTID);
+        for (const dom::Cmper partId : allPartIds) {
+            document->discardPartCaches(partId, Kind::Staves);
+        }
+        document->createPartMembershipTable();
+    }
+    if (hasKind(Kind::Expressions)) {
+        for (const dom::Cmper partId : allPartIds) {
+            for (const auto& category : document->getOthers()->getArray<dom::others::MarkingCategory>(partId)) {
+                auto* mutableCategory = const_cast<dom::others::MarkingCategory*>(category.get());
+                mutableCategory->textExpressions.clear();
+                mutableCategory->shapeExpressions.clear();
+            }
+        }
+        resolveExpressions<dom::others::ShapeExpressionDef>(document);
+        resolveExpressions<dom::others::TextExpressionDef>(document);
+        document->createRehearsalMarkMap();
+    }
+    const auto calcAffectedParts = [&](const dom::EditScope& scope) {
+        std::vector<dom::Cmper> result;
+        for (const dom::Cmper partId : allPartIds) {
+            if (scope.partId && scope.partId != partId) continue;
+            if (scope.staffId && !document->isStaffInPart(*scope.staffId, partId)) continue;
+            result.push_back(partId);
+        }
+        return result;
+    };
+
+    std::optional<dom::MeasCmper> lastMeasure;
+    bool layoutChanged = false;
+    for (const auto& scope : scopes) {
+        switch (scope.kind) {
+        case Kind::Entries:
+            if (!scope.staffId && !scope.startMeasure && !scope.endMeasure) {
+                resolveEntries(document);
+                document->createSortedTupletMap();
+            } else {
+                if (!lastMeasure) {
+                    lastMeasure = dom::MeasCmper(document->getOthers()->getArray<dom::others::Measure>(dom::SCORE_PARTID).size());
+                }
+                const dom::MeasCmper startMeas = scope.startMeasure.value_or(1);
+                const dom::MeasCmper endMeas = (std::min)(scope.endMeasure.value_or(*lastMeasure), *lastMeasure);
+                std::vector<dom::StaffCmper> staves;
+                if (scope.staffId) {
+                    staves.push_back(*scope.staffId);
+                } else {
+                    for (const auto& staff : document->getOthers()->getArray<dom::others::Staff>(dom::SCORE_PARTID)) {
+                        staves.push_back(staff->getCmper());
+                    }
+                }
+                for (const dom::StaffCmper staffId : staves) {
+                    dom::Entry::calcLocations(document, staffId, startMeas, endMeas);
+                    for (dom::MeasCmper measureId = startMeas; measureId <= endMeas; measureId++) {
+                        for (const dom::EntryNumber entryNumber : document->getEntries()->getFrameEntries(staffId, measureId)) {
+                            document->updateSortedTuplets(entryNumber);
+                        }
+                    }
+                }
+            }
+            for (const dom::Cmper partId : calcAffectedParts(scope)) {
+                document->discardPartCaches(partId, scope.kind);
+            }
+            break;
+        case Kind::Measures:
+            for (const dom::Cmper partId : calcAffectedParts(scope)) {
+                document->discardPartCaches(partId, scope.kind);
+            }
+            break;
+        case Kind::Layout:
+            for (const dom::Cmper partId : calcAffectedParts(scope)) {
+                dom::others::Page::calcSystemInfo(document, partId);
+            }
+            layoutChanged = true;
+            break;
+        case Kind::Staves:
+        case Kind::Expressions:
+            break; // handled above
+        }
+    }
+    if (layoutChanged) {
+        calcLeadingBlankPages(document);
+    }
+}
+
 } // namespace factory
 } // namespace musx
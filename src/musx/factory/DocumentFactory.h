@@ -61,6 +61,7 @@ public:
         std::optional<double> scoreDurationSeconds;
         dom::EmbeddedGraphicsMap embeddedGraphics;
         std::optional<std::filesystem::path> sourcePath;
+        std::shared_ptr<LoadProfile> profile;   ///< If set, receives a timing breakdown of construction. See @ref LoadProfile.
     };
 
     /** @brief Optional inputs accepted by the existing XML creation interface. */
@@ -86,6 +87,7 @@ public:
         {}
 
         dom::PartVoicingPolicy partVoicingPolicy = dom::PartVoicingPolicy::Ignore;
+        std::shared_ptr<LoadProfile> profile;   ///< If set, receives a timing breakdown of xml parsing and construction.
 
         [[nodiscard]] const std::vector<char>& getNotationMetadata() const { return m_notationMetadata; }
         [[nodiscard]] const dom::EmbeddedGraphicsMap& getEmbeddedGraphics() const { return m_embeddedGraphics; }
@@ -145,6 +147,17 @@ public:
         friend class DocumentFactory;
     };
 
+    /**
+     * @brief Recomputes the derived data invalidated by the edits marked with @ref dom::Document::markDirty.
+     *
+     * Only the resolvers affected by each @ref dom::EditScope re-run, limited to its staff, measure range, or part.
+     * Lazily built per-part caches that depend on the edited data, such as tie graphs and smart shape indexes,
+     * are discarded and rebuilt on next use, so references previously obtained from them become invalid.
+     * Does nothing if no edits are marked.
+     * @param document A finalized document.
+     */
+    static void refresh(const DocumentPtr& document);
+
     /** @brief Begins construction of a document from client-provided data. */
     [[nodiscard]] static ConstructionSession begin();
     [[nodiscard]] static ConstructionSession begin(ConstructionOptions options);
@@ -167,7 +180,10 @@ public:
         static_assert(std::is_base_of_v<xml::IXmlDocument, XmlDocumentType>,
             "XmlDocumentType must derive from IXmlDocument.");
         auto xmlDocument = std::make_unique<XmlDocumentType>();
-        xmlDocument->loadFromBuffer(data, size);
+        {
+            LoadProfile::ScopedPhase phase(createOptions.profile.get(), "parse");
+            xmlDocument->loadFromBuffer(data, size);
+        }
         auto root = xmlDocument->getRootElement();
         if (!root || root->getTagName() != "finale") {
             throw std::invalid_argument("Missing <finale> element.");
@@ -179,6 +195,7 @@ public:
             createOptions.getNotationMetadata());
         options.embeddedGraphics = createOptions.takeEmbeddedGraphics();
         options.sourcePath = createOptions.getSourcePath();
+        options.profile = std::move(createOptions.profile);
         return createFromXmlRoot(root, std::move(options));
     }
 
@@ -192,6 +209,7 @@ private:
     static DocumentPtr createFromXmlRoot(
         const xml::XmlElementPtr& root, ConstructionOptions&& options);
     static void finalize(const DocumentPtr& document, ConstructionContext& context);
+    static void calcLeadingBlankPages(const DocumentPtr& document);
 
     template <typename Container>
     static const char* asCharData(const Container& buffer)
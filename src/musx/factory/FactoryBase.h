@@ -72,9 +72,11 @@ protected:
         if (auto childElement = element->getFirstChildElement(nodeName)) {
             dataField = parserFunc(childElement);
         } else if (expected) {
-            std::stringstream msg;
-            msg << "Expected field <" << element->getTagName() << "><" << nodeName << "> not found.";
-            util::Logger::log(util::Logger::LogLevel::Warning, msg.str());
+            util::Logger::log(util::Logger::LogLevel::Warning, [&]() {
+                std::stringstream msg;
+                msg << "Expected field <" << element->getTagName() << "><" << nodeName << "> not found.";
+                return msg.str();
+            });
         }
     }
 
@@ -100,6 +100,9 @@ MUSX_XML_ELEMENT_ARRAY(Entry, {
         if (!noteAttr) {
             throw std::invalid_argument("Note in entry " + std::to_string(i->getEntryNumber()) + " has no id attribute.");
         }
+        if (i->notes.empty() && i->numNotes > 0) {
+            i->notes.reserve(static_cast<size_t>(i->numNotes));
+        }
         i->notes.push_back(FieldPopulator<Note>::createAndPopulate(c, e, i->getDocument(), noteAttr->getValueAs<NoteNumber>()));
     }},
 });
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace musx {
+namespace factory {
+
+/**
+ * @brief An opt-in breakdown of where the time went while creating one document.
+ *
+ * Pass a profile in @ref DocumentFactory::CreateOptions::profile or @ref DocumentFactory::ConstructionOptions::profile.
+ * The factory appends a #Phase for xml parsing, each top-level pool, each pool's integrity check, each resolver,
+ * and each remaining finalize step, and counts the objects created for each xml node name. When no profile is
+ * supplied, none of this is recorded.
+ *
+ * Phase names are `parse`, `pool:<tag>`, `integrity:<pool>`, `sortedTuplets`, `resolver:<XmlNodeName>`,
+ * `instruments`, `partMembership`, `rehearsalMarks`, and `blankPages`.
+ */
+struct LoadProfile
+{
+    /// @brief The measurements for one phase of construction.
+    struct Phase
+    {
+        std::string name;                       ///< The phase name.
+        std::chrono::nanoseconds duration{};    ///< Wall time spent in the phase.
+        std::optional<size_t> allocations;      ///< Allocations during the phase. Set only if #allocationCounter is supplied.
+    };
+
+    /// @brief Optional running allocation count, for example from a replaced global `operator new`.
+    ///
+    /// The library does not replace the global allocator, so allocation counts are only reported if the caller provides them.
+    std::function<size_t()> allocationCounter;
+
+    std::vector<Phase> phases;                              ///< The phases in the order they ran.
+    std::map<std::string, size_t, std::less<>> nodeCounts;  ///< The number of objects created for each xml node name.
+
+    /// @brief Returns the sum of the durations of all phases.
+    [[nodiscard]] std::chrono::nanoseconds calcTotalDuration() const
+    {
+        std::chrono::nanoseconds result{};
+        for (const auto& phase : phases) {
+            result += phase.duration;
+        }
+        return result;
+    }
+
+    /// @brief Returns the first phase with the given name, or nullptr if there is none.
+    [[nodiscard]] const Phase* findPhase(std::string_view name) const
+    {
+        for (const auto& phase : phases) {
+            if (phase.name == name) {
+                return &phase;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Adds one to the count for @p xmlNodeName.
+    void countNode(std::string_view xmlNodeName)
+    {
+        if (auto it = nodeCounts.find(xmlNodeName); it != nodeCounts.end()) {
+            ++it->second;
+        } else {
+            nodeCounts.emplace(std::string(xmlNodeName), 1);
+        }
+    }
+
+    /// @brief Records a phase from construction to destruction. Does nothing if the profile is null.
+    class ScopedPhase
+    {
+    public:
+        /// @brief Starts timing a phase named @p name, or `name:detail` if @p detail is not empty.
+        ScopedPhase(LoadProfile* profile, std::string_view name, std::string_view detail = {})
+            : m_profile(profile)
+        {
+            if (!m_profile) {
+                return;
+            }
+            m_name = std::string(name);
+            if (!detail.empty()) {
+                m_name += ':';
+                m_name += detail;
+            }
+            if (m_profile->allocationCounter) {
+                m_allocationsAtStart = m_profile->allocationCounter();
+            }
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        ~ScopedPhase()
+        {
+            if (!m_profile) {
+                return;
+            }
+            Phase phase;
+            phase.name = std::move(m_name);
+            phase.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+            if (m_allocationsAtStart) {
+                phase.allocations = m_profile->allocationCounter() - *m_allocationsAtStart;
+            }
+            m_profile->phases.push_back(std::move(phase));
+        }
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+    private:
+        LoadProfile* m_profile;
+        std::string m_name;
+        std::chrono::steady_clock::time_point m_start;
+        std::optional<size_t> m_allocationsAtStart;
+    };
+};
+
+} // namespace factory
+} // namespace musx
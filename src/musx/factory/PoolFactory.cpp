@@ -355,6 +355,7 @@ std::shared_ptr<PoolType> createPool(const xml::XmlElementPtr& element,
                                      Extractor&& extractor)
 {
     auto pool = std::make_shared<PoolType>(document);
+    LoadProfile* profile = context.getLoadProfile();
 #ifdef MUSX_DISPLAY_NODE_NAMES
     std::string currentTag;
     size_t currentTagCount = 0;
@@ -387,6 +388,9 @@ std::shared_ptr<PoolType> createPool(const xml::XmlElementPtr& element,
                 throw std::logic_error("Unable to cast instance to correct type for "
                     + std::string(info->xmlNodeName));
             }
+            if (profile) {
+                profile->countNode(info->xmlNodeName);
+            }
             if constexpr (std::is_same_v<PoolType, dom::EntryPool>) {
                 const auto entryNumber = typed->getEntryNumber();
                 pool->add(entryNumber, std::move(typed));
@@ -42,6 +42,8 @@
  * which are always silently skipped.
  * - `MUSX_THROW_ON_INTEGRITY_CHECK_FAIL`: Throws `musx::dom::integrity_error` if a class fails its integrity check.
  * Otherwise it it logs the message, which by default sends it to `std::cerr`.
+ * - `MUSX_COMPACT_ENTRIES`: Stores the boolean members of `musx::dom::Entry` and `musx::dom::Note` as one-bit fields. This saves
+ * memory in large scores, but references and pointers to those members can no longer be formed.
  *
  * The recommended way to define these macros is from your make file or build project. They are primarily intended
  * for debugging.
@@ -71,10 +73,15 @@
 #include "util/Layout.h"
 #include "util/Arpeggio.h"
 #include "util/ArrowheadPresets.h"
+#include "util/AsyncLogSink.h"
+#include "util/ContentHash.h"
 #include "util/Cue.h"
 #include "util/DateTimeFormat.h"
 #include "util/EnigmaString.h"
 #include "util/Fretboard.h"
+#include "util/NoteEventStream.h"
+#include "util/PitchTable.h"
+#include "util/PlaybackSequence.h"
 #include "util/PseudoTieUtils.h"
 #include "util/ShapeRecognize.h"
 #include "util/SmartShapeRecognize.h"
@@ -92,8 +99,14 @@
 #include "dom/Staff.h"
 #include "dom/Texts.h"
 #include "dom/Document.h"
+#include "factory/LoadProfile.h"
 #include "factory/DocumentFactory.h"
+#include "factory/DocumentCache.h"
 #include "dom/Instrument.h"
+#include "dom/LyricIndex.h"
+#include "dom/GlobalTimeline.h"
+#include "dom/TieGraph.h"
+#include "dom/SmartShapeIndex.h"
 #include "dom/InstrumentUuids.h"
 #include "dom/PercussionNoteType.h"
 
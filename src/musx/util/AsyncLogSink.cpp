@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AsyncLogSink.h"
+
+#include <iostream>
+#include <utility>
+
+namespace musx::util {
+
+AsyncLogSink::AsyncLogSink(size_t capacity, Logger::LogCallback target)
+    : m_target(std::move(target))
+{
+    size_t slotCount = 2;
+    while (slotCount < capacity) {
+        slotCount <<= 1;
+    }
+    m_slots = std::make_unique<Slot[]>(slotCount);
+    m_mask = slotCount - 1;
+    for (size_t x = 0; x < slotCount; x++) {
+        m_slots[x].sequence.store(x, std::memory_order_relaxed);
+    }
+    m_thread = std::thread([this]() { run(); });
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop.store(true, std::memory_order_release);
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+bool AsyncLogSink::push(Logger::LogLevel level, std::string message)
+{
+    // Bounded multi-producer ring buffer: each slot's sequence number tells a producer whether
+    // the slot is free for the position it is trying to claim.
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &m_slots[pos & m_mask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->level = level;
+    slot->message = std::move(message);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogSink::flush()
+{
+    const size_t target = m_enqueuePos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    m_wake.notify_one();
+    m_drained.wait(lock, [&]() { return m_dequeuePos.load(std::memory_order_acquire) >= target; });
+}
+
+Logger::LogCallback AsyncLogSink::createCallback()
+{
+    return [this](Logger::LogLevel level, const std::string& message) {
+        push(level, message);
+    };
+}
+
+void AsyncLogSink::drain()
+{
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = m_slots[pos & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        const Logger::LogLevel level = slot.level;
+        std::string message = std::move(slot.message);
+        slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+        try {
+            if (m_target) {
+                m_target(level, message);
+            } else {
+                std::cerr << message << '\n';
+            }
+        } catch (...) {
+            // a failing target must not take down the logging thread
+        }
+        // advance only after delivery, so that flush() does not return while a message is still being delivered
+        m_dequeuePos.store(++pos, std::memory_order_release);
+    }
+}
+
+void AsyncLogSink::run()
+{
+    while (true) {
+        drain();
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_drained.notify_all();
+        if (m_stop.load(std::memory_order_acquire)) {
+            break;
+        }
+        m_wake.wait_for(lock, POLL_INTERVAL);
+    }
+    drain();
+    m_drained.notify_all();
+}
+
+} // namespace musx::util
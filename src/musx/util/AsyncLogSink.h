@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Logger.h"
+
+namespace musx::util {
+
+/**
+ * @class AsyncLogSink
+ * @brief A @ref Logger target that queues messages in a fixed-size lock-free ring buffer and delivers them on a background thread.
+ *
+ * Producers never block and never take a lock: #push reserves a slot with a single compare-and-swap, and drops
+ * the message (counting it in #getDroppedCount) if the buffer is full. A single background thread drains the
+ * buffer in order and hands each message to the target callback, or to `std::cerr` if no target was supplied.
+ *
+ * Install it with `Logger::setCallback(sink.createCallback())`. The sink must outlive any callback created from it,
+ * so restore or clear the Logger callback before the sink is destroyed. Destroying the sink delivers any messages
+ * still in the buffer.
+ */
+class AsyncLogSink
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096; ///< The default number of ring buffer slots.
+
+    /// @brief Constructs the sink and starts its background thread.
+    /// @param capacity The number of ring buffer slots. It is rounded up to a power of two.
+    /// @param target The callback that receives drained messages on the background thread. If null, messages are written to `std::cerr`.
+    explicit AsyncLogSink(size_t capacity = DEFAULT_CAPACITY, Logger::LogCallback target = nullptr);
+
+    /// @brief Stops the background thread after delivering all queued messages.
+    ~AsyncLogSink();
+
+    AsyncLogSink(const AsyncLogSink&) = delete;             ///< not copyable
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;  ///< not assignable
+
+    /// @brief Queues a message for delivery. Safe to call from any number of threads.
+    /// @return True if the message was queued, false if the buffer was full and the message was dropped.
+    bool push(Logger::LogLevel level, std::string message);
+
+    /// @brief Blocks until every message queued before the call has been delivered.
+    void flush();
+
+    /// @brief Returns the number of slots in the ring buffer.
+    size_t getCapacity() const noexcept { return m_mask + 1; }
+
+    /// @brief Returns the number of messages dropped because the buffer was full.
+    size_t getDroppedCount() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+    /// @brief Creates a callback suitable for @ref Logger::setCallback that queues messages in this sink.
+    ///
+    /// The callback holds a plain pointer to this sink. Replace or clear the Logger callback before the sink
+    /// is destroyed, or the callback dangles.
+    Logger::LogCallback createCallback();
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence{};
+        Logger::LogLevel level{};
+        std::string message;
+    };
+
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{ 2 };
+
+    void run();
+    void drain();
+
+    std::unique_ptr<Slot[]> m_slots;
+    size_t m_mask{};
+    std::atomic<size_t> m_enqueuePos{};
+    std::atomic<size_t> m_dequeuePos{};
+    std::atomic<size_t> m_dropped{};
+    std::atomic<bool> m_stop{};
+    Logger::LogCallback m_target;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_drained;
+    std::thread m_thread;
+};
+
+} // namespace musx::util
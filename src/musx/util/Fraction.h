@@ -21,6 +21,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <numeric>
 #include <stdexcept>
@@ -34,28 +35,113 @@ namespace util {
 /**
  * @class Fraction
  * @brief A class to represent fractions with integer m_numerator and m_denominator, automatically reduced to simplest form.
+ *
+ * Arithmetic is carried out in 64-bit intermediates and reduced before being stored, so results that fit in
+ * int are always exact. Define MUSX_CHECKED_FRACTION (CMake option of the same name) to throw std::overflow_error
+ * when a reduced result does not fit, as can happen with deeply nested tuplets.
  */
 class [[nodiscard]] Fraction {
 private:
     int m_numerator = 0;    ///< The m_numerator of the fraction.
     int m_denominator = 1;  ///< The m_denominator of the fraction.
 
+    using Wide = std::int64_t; ///< Intermediate type for products, so that arithmetic on two valid fractions cannot overflow before reduction.
+
+    /// @brief Returns true if @p value is a positive power of two.
+    static constexpr bool isPowerOfTwo(Wide value) noexcept
+    { return value > 0 && (value & (value - 1)) == 0; }
+
+    /// @brief Counts trailing zero bits of a nonzero value.
+    static constexpr int countTrailingZeros(std::uint64_t value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+#else
+        int result = 0;
+        while ((value & 1u) == 0) {
+            value >>= 1;
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    /// @brief Returns the magnitude of @p value as unsigned. (Safe for the most negative value.)
+    static constexpr std::uint64_t magnitude(Wide value) noexcept
+    { return value < 0 ? std::uint64_t(0) - std::uint64_t(value) : std::uint64_t(value); }
+
+    /**
+     * @brief Narrows a reduced wide value back to int.
+     *
+     * With MUSX_CHECKED_FRACTION defined, a value outside the range of int throws std::overflow_error.
+     * Otherwise it is truncated, matching the historical behavior of int arithmetic.
+     */
+    static constexpr int narrow(Wide value)
+    {
+#ifdef MUSX_CHECKED_FRACTION
+        if (value > Wide((std::numeric_limits<int>::max)()) || value < Wide((std::numeric_limits<int>::min)())) {
+            throw std::overflow_error("Fraction value does not fit in int.");
+        }
+#endif
+        return static_cast<int>(value);
+    }
+
     /**
      * @brief Reduces the input to its simplest form.
      * Ensures the denominator is always positive.
+     *
+     * Denominators that are powers of two (the usual case for Edu-based durations) are reduced by
+     * shifting out common trailing zero bits, which avoids the cost of std::gcd.
      */
-    static constexpr std::pair<int, int> reduce(int num, int den) {
-        int gcd = std::gcd(num, den);
-        num /= gcd;
-        den /= gcd;
-
+    static constexpr std::pair<int, int> reduce(Wide num, Wide den) {
         // Ensure denominator is always positive
         if (den < 0) {
             num = -num;
             den = -den;
         }
 
-        return {num, den};
+        if (num == 0) {
+            return {0, 1};
+        }
+
+        if (isPowerOfTwo(den)) {
+            const int numZeros = countTrailingZeros(magnitude(num));
+            const int denZeros = countTrailingZeros(std::uint64_t(den));
+            const int shift = numZeros < denZeros ? numZeros : denZeros;
+            // divide rather than shift so that negative numerators are exact
+            const Wide divisor = Wide(1) << shift;
+            return {narrow(num / divisor), narrow(den >> shift)};
+        }
+
+        const Wide gcd = std::gcd(num, den);
+        return {narrow(num / gcd), narrow(den / gcd)};
+    }
+
+    /// @brief Constructs from already reduced values.
+    static constexpr Fraction fromReduced(std::pair<int, int> reduced)
+    {
+        Fraction result;
+        result.m_numerator = reduced.first;
+        result.m_denominator = reduced.second;
+        return result;
+    }
+
+    /// @brief Adds or subtracts fractions, using the larger denominator directly when both are powers of two.
+    static constexpr Fraction addImpl(const Fraction& lhs, const Fraction& rhs, bool subtract)
+    {
+        const Wide rhsNum = subtract ? -Wide(rhs.m_numerator) : Wide(rhs.m_numerator);
+        if (isPowerOfTwo(lhs.m_denominator) && isPowerOfTwo(rhs.m_denominator)) {
+            // One power-of-two denominator always divides the other.
+            if (lhs.m_denominator >= rhs.m_denominator) {
+                const Wide scale = lhs.m_denominator / rhs.m_denominator;
+                return fromReduced(reduce(Wide(lhs.m_numerator) + rhsNum * scale, lhs.m_denominator));
+            }
+            const Wide scale = rhs.m_denominator / lhs.m_denominator;
+            return fromReduced(reduce(Wide(lhs.m_numerator) * scale + rhsNum, rhs.m_denominator));
+        }
+        return fromReduced(reduce(
+            Wide(lhs.m_numerator) * rhs.m_denominator + rhsNum * lhs.m_denominator,
+            Wide(lhs.m_denominator) * rhs.m_denominator));
     }
 
     friend class std::numeric_limits<Fraction>;
@@ -192,10 +278,7 @@ public:
      * @return The resulting fraction after addition.
      */
     Fraction constexpr operator+(const Fraction& other) const {
-        return Fraction(
-            m_numerator * other.m_denominator + other.m_numerator * m_denominator,
-            m_denominator * other.m_denominator
-        );
+        return addImpl(*this, other, false);
     }
 
     /**
@@ -204,10 +287,7 @@ public:
      * @return The resulting fraction after subtraction.
      */
     Fraction constexpr operator-(const Fraction& other) const {
-        return Fraction(
-            m_numerator * other.m_denominator - other.m_numerator * m_denominator,
-            m_denominator * other.m_denominator
-        );
+        return addImpl(*this, other, true);
     }
 
     /**
@@ -216,10 +296,10 @@ public:
      * @return The resulting fraction after multiplication.
      */
     Fraction constexpr operator*(const Fraction& other) const {
-        return Fraction(
-            m_numerator * other.m_numerator,
-            m_denominator * other.m_denominator
-        );
+        return fromReduced(reduce(
+            Wide(m_numerator) * other.m_numerator,
+            Wide(m_denominator) * other.m_denominator
+        ));
     }
 
     /**
@@ -229,10 +309,13 @@ public:
      * @throws std::invalid_argument if attempting to divide by a fraction with a zero m_numerator.
      */
     constexpr Fraction operator/(const Fraction& other) const {
-        return Fraction(
-            m_numerator * other.m_denominator,
-            m_denominator * other.m_numerator
-        );
+        if (other.m_numerator == 0) {
+            throw std::invalid_argument("Denominator cannot be zero.");
+        }
+        return fromReduced(reduce(
+            Wide(m_numerator) * other.m_denominator,
+            Wide(m_denominator) * other.m_numerator
+        ));
     }
 
     /**
@@ -302,9 +385,8 @@ public:
      */
     [[nodiscard]]
     constexpr bool operator<(const Fraction& other) const {
-        double lhs = static_cast<double>(m_numerator) / m_denominator;
-        double rhs = static_cast<double>(other.m_numerator) / other.m_denominator;
-        return lhs < rhs;
+        // Denominators are always positive, so cross-multiplying preserves the ordering.
+        return Wide(m_numerator) * other.m_denominator < Wide(other.m_numerator) * m_denominator;
     }
 
     /**
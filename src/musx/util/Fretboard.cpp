@@ -72,7 +72,7 @@ std::optional<FretboardDisplayData> calcFretboardDisplayData(
     }
     // Finale suppresses a fretboard from three independent places: the chord assignment itself
     // (checked above), the document-wide chord options, and the staff in effect where the chord sits.
-    const auto chordOptions = chord->getDocument()->getOptions()->get<dom::options::ChordOptions>();
+    const auto chordOptions = chord->getDocumentRef().getOptions()->get<dom::options::ChordOptions>();
     if (!chordOptions || !chordOptions->showFretboards) {
         return std::nullopt;
     }
@@ -21,9 +21,12 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace musx {
 namespace util {
@@ -34,7 +37,15 @@ namespace util {
  * The `Logger` class provides a centralized mechanism for logging messages
  * with different severity levels. By default, messages are sent to `std::cerr`,
  * but a custom logging callback can be registered to handle messages in other ways
- * (e.g., writing to a file, console, or network).
+ * (e.g., writing to a file, console, or network). @ref AsyncLogSink provides a
+ * callback that moves delivery off the calling thread.
+ *
+ * Each level can be disabled with #setLevelEnabled. A disabled level is rejected before
+ * the message is formatted when the message is passed as a callable:
+ *
+ * @code
+ * util::Logger::log(util::Logger::LogLevel::Verbose, [&]() { return "Entry " + std::to_string(entnum) + " was skipped."; });
+ * @endcode
  */
 class Logger {
 public:
@@ -75,6 +86,29 @@ public:
         return getInstance().m_callback;
     }
 
+    /**
+     * @brief Enables or disables delivery of messages at a severity level. All levels are enabled by default.
+     *
+     * @param level The severity level to change.
+     * @param enabled Whether messages at @p level are delivered.
+     */
+    static void setLevelEnabled(LogLevel level, bool enabled) noexcept {
+        if (enabled) {
+            getInstance().m_enabledLevels.fetch_or(levelBit(level), std::memory_order_relaxed);
+        } else {
+            getInstance().m_enabledLevels.fetch_and(~levelBit(level), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns whether messages at a severity level are delivered.
+     *
+     * Check this before building an expensive message, or pass the message to #log as a callable.
+     */
+    static bool isLevelEnabled(LogLevel level) noexcept {
+        return (getInstance().m_enabledLevels.load(std::memory_order_relaxed) & levelBit(level)) != 0;
+    }
+
     /**
      * @brief Logs a message with a specific severity level.
      *
@@ -85,10 +119,21 @@ public:
      * the default behavior writes the message to `std::cerr`.
      */
     static void log(LogLevel level, const std::string& message) {
-        if (getInstance().m_callback) {
-            getInstance().m_callback(level, message);
-        } else {
-            std::cerr << message << std::endl;
+        if (isLevelEnabled(level)) {
+            deliver(level, message);
+        }
+    }
+
+    /**
+     * @brief Logs a message that is formatted only if @p level is enabled.
+     *
+     * @param level The severity level of the message.
+     * @param formatter A callable with no arguments that returns the message string.
+     */
+    template <typename Formatter, std::enable_if_t<std::is_invocable_r_v<std::string, Formatter>, int> = 0>
+    static void log(LogLevel level, Formatter&& formatter) {
+        if (isLevelEnabled(level)) {
+            deliver(level, std::forward<Formatter>(formatter)());
         }
     }
 
@@ -108,8 +153,23 @@ private:
         return instance;
     }
 
+    static constexpr unsigned levelBit(LogLevel level) noexcept {
+        return 1u << static_cast<unsigned>(level);
+    }
+
+    static void deliver(LogLevel level, const std::string& message) {
+        if (getInstance().m_callback) {
+            getInstance().m_callback(level, message);
+        } else {
+            std::cerr << message << '\n';
+        }
+    }
+
     /// The logging callback function.
     LogCallback m_callback;
+
+    /// Bit mask of enabled levels, indexed by LogLevel value.
+    std::atomic<unsigned> m_enabledLevels{ ~0u };
 };
 
 } // namespace util
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/util/NoteEventStream.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "musx/musx.h"
+
+namespace musx::util {
+
+using namespace dom;
+
+namespace {
+
+/// Guards against malformed tie chains that would otherwise never terminate.
+constexpr size_t MAX_TIE_CHAIN_LENGTH = 1024;
+
+/// Only real ties that Finale plays back as one sustained note are merged. Stand-in and jump ties are not.
+/// @param link The link to check.
+/// @param to The note at the end of the link.
+bool isMergedTie(const TieGraph::Link* link, const NoteInfoPtr& to)
+{
+    return link && link->type == TieGraph::LinkType::Tie && to && to->tieEnd;
+}
+
+} // namespace
+
+void NoteEventStream::EventBuffer::clear()
+{
+    startTimes.clear();
+    durations.clear();
+    staves.clear();
+    layers.clear();
+    pitches.clear();
+    velocities.clear();
+}
+
+void NoteEventStream::EventBuffer::reserve(size_t count)
+{
+    startTimes.reserve(count);
+    durations.reserve(count);
+    staves.reserve(count);
+    layers.reserve(count);
+    pitches.reserve(count);
+    velocities.reserve(count);
+}
+
+void NoteEventStream::EventBuffer::push_back(Fraction startTime, Fraction duration, StaffCmper staffId, LayerIndex layerIndex, int pitch, uint8_t velocity)
+{
+    startTimes.push_back(startTime);
+    durations.push_back(duration);
+    staves.push_back(staffId);
+    layers.push_back(layerIndex);
+    pitches.push_back(pitch);
+    velocities.push_back(velocity);
+}
+
+NoteEventStream::NoteEventStream(const DocumentPtr& document, Cmper partId)
+    : m_document(document), m_partId(partId)
+{
+    for (const auto& staffUsed : document->getScrollViewStaves(partId)) {
+        m_staves.push_back(staffUsed->staffId);
+    }
+}
+
+int NoteEventStream::calcMidiKey(const NoteInfoPtr& noteInfo)
+{
+    constexpr int middleCOctave = 4;
+
+    const auto properties = noteInfo.calcNoteProperties({ PitchMode::Concert });
+    int edoDivisions = music_theory::STANDARD_12EDO_STEPS;
+    if (const auto keySig = noteInfo.getEntryInfo().getKeySignature()) {
+        if (const int keyDivisions = keySig->calcEDODivisions(); keyDivisions > 0) {
+            edoDivisions = keyDivisions;
+        }
+    }
+    const auto naturalKeyMap = edoDivisions == music_theory::STANDARD_12EDO_STEPS
+        ? music_theory::MAJOR_KEYMAP
+        : music_theory::calcNaturalKeyMap(edoDivisions);
+    const int divisions = naturalKeyMap[size_t(properties.noteName)] + properties.alteration
+        + (properties.octave - middleCOctave) * edoDivisions;
+    return music_theory::calcMidiKey(divisions, edoDivisions);
+}
+
+size_t NoteEventStream::appendMeasure(MeasCmper measureId, EventBuffer& buffer, std::optional<Fraction> timeOffset) const
+{
+    const auto& timeline = m_document->getGlobalTimeline(m_partId);
+    const auto& tieGraph = m_document->getTieGraph(m_partId);
+    EntryInfoResolver tiedNotes(m_document, m_partId);
+    const Fraction shift = timeOffset ? *timeOffset - timeline.getMeasureStart(measureId) : Fraction(0);
+    const size_t firstIndex = buffer.size();
+
+    for (const StaffCmper staffId : m_staves) {
+        details::GFrameHoldContext gfHold(m_document, m_partId, staffId, measureId);
+        if (!gfHold) {
+            continue;
+        }
+        gfHold.iterateEntries([&](const EntryInfoPtr& entryInfo) {
+            const auto entry = entryInfo->getEntry();
+            if (!entry->isNote || entry->graceNote) {
+                return true;
+            }
+            const Fraction startTime = timeline.calcAbsolutePosition(entryInfo);
+            for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+                const NoteInfoPtr noteInfo(entryInfo, noteIndex);
+                if (noteInfo->noPlayback) {
+                    continue;
+                }
+                // continuations of a tie were merged into the event of the note that starts the chain
+                if (isMergedTie(tieGraph.getTieFrom(noteInfo), noteInfo)) {
+                    continue;
+                }
+                NoteInfoPtr lastInChain = noteInfo;
+                for (size_t chainLength = 0; chainLength < MAX_TIE_CHAIN_LENGTH; chainLength++) {
+                    const auto* link = tieGraph.getTieTo(lastInChain);
+                    if (!link || link->type != TieGraph::LinkType::Tie) {
+                        break;
+                    }
+                    const NoteInfoPtr tiedTo = link->to.calcNoteInfo(tiedNotes);
+                    if (!isMergedTie(link, tiedTo)) {
+                        break;
+                    }
+                    lastInChain = tiedTo;
+                }
+                const auto lastEntry = lastInChain.getEntryInfo();
+                const Fraction endTime = timeline.calcAbsolutePosition(lastEntry) + lastEntry.calcGlobalActualDuration();
+                buffer.push_back(startTime + shift, endTime - startTime, staffId, entryInfo.getLayerIndex(),
+                    calcMidiKey(noteInfo), DEFAULT_VELOCITY);
+            }
+            return true;
+        });
+    }
+
+    // Sort the new events by (start time, staff, layer, pitch) through an index permutation.
+    const size_t count = buffer.size() - firstIndex;
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), firstIndex);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        if (buffer.startTimes[lhs] != buffer.startTimes[rhs]) {
+            return buffer.startTimes[lhs] < buffer.startTimes[rhs];
+        }
+        if (buffer.staves[lhs] != buffer.staves[rhs]) {
+            return buffer.staves[lhs] < buffer.staves[rhs];
+        }
+        if (buffer.layers[lhs] != buffer.layers[rhs]) {
+            return buffer.layers[lhs] < buffer.layers[rhs];
+        }
+        return buffer.pitches[lhs] < buffer.pitches[rhs];
+    });
+    const auto permute = [&](auto& values) {
+        using Values = std::remove_reference_t<decltype(values)>;
+        Values sorted;
+        sorted.reserve(count);
+        for (const size_t index : order) {
+            sorted.push_back(values[index]);
+        }
+        std::copy(sorted.begin(), sorted.end(), values.begin() + std::ptrdiff_t(firstIndex));
+    };
+    permute(buffer.startTimes);
+    permute(buffer.durations);
+    permute(buffer.staves);
+    permute(buffer.layers);
+    permute(buffer.pitches);
+    permute(buffer.velocities);
+    return count;
+}
+
+bool NoteEventStream::iterateMeasures(const std::function<bool(MeasCmper, const EventBuffer&)>& callback) const
+{
+    const auto& timeline = m_document->getGlobalTimeline(m_partId);
+    EventBuffer buffer;
+    for (MeasCmper measureId = 1; measureId <= timeline.getMeasureCount(); measureId++) {
+        buffer.clear();
+        appendMeasure(measureId, buffer);
+        if (!callback(measureId, buffer)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NoteEventStream::EventBuffer NoteEventStream::calcAllEvents() const
+{
+    EventBuffer result;
+    const auto& timeline = m_document->getGlobalTimeline(m_partId);
+    for (MeasCmper measureId = 1; measureId <= timeline.getMeasureCount(); measureId++) {
+        appendMeasure(measureId, result);
+    }
+    return result;
+}
+
+} // namespace musx::util
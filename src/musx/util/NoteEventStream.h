@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "musx/dom/Entries.h"
+#include "musx/util/Fraction.h"
+
+namespace musx::util {
+
+/**
+ * @class NoteEventStream
+ * @brief Exports the notes of a score or linked part as a time-ordered stream of note events.
+ *
+ * Each event has an absolute start time and duration (as fractions of a whole note from the start of measure 1,
+ * see @ref dom::GlobalTimeline), the staff and layer of the entry, a MIDI key number, and a velocity placeholder.
+ * Tied notes are merged into a single event that starts at the first note of the tie chain and lasts until the end
+ * of the last one. Rests, grace notes, and notes marked @ref dom::Note::noPlayback produce no events.
+ *
+ * Events are written into an @ref EventBuffer, a structure of arrays suited to bulk processing. The stream is
+ * produced one measure at a time from @ref dom::EntryFrame instances, so memory stays bounded by the events of a
+ * single measure. Because every event in a measure starts at or after that measure's start time, the
+ * measure-by-measure output is globally sorted.
+ *
+ * Times follow the notated measure order. To follow playback through repeats, drive #appendMeasure with the steps
+ * of a @ref PlaybackSequence and the running playback time as @p timeOffset.
+ */
+class NoteEventStream
+{
+public:
+    /// @brief The velocity written to every event until dynamics are interpreted.
+    static constexpr uint8_t DEFAULT_VELOCITY = 64;
+
+    /// @brief Note events as a structure of arrays. All arrays always have the same length.
+    struct EventBuffer
+    {
+        std::vector<Fraction> startTimes;           ///< Absolute start time of each event.
+        std::vector<Fraction> durations;            ///< Duration of each event, including any tied continuation.
+        std::vector<dom::StaffCmper> staves;        ///< Staff of the entry that starts the event.
+        std::vector<dom::LayerIndex> layers;        ///< Layer of the entry that starts the event.
+        std::vector<int> pitches;                   ///< MIDI key number of the sounding (concert) pitch, where middle C is 60.
+        std::vector<uint8_t> velocities;            ///< Velocity placeholder. (Currently always #DEFAULT_VELOCITY.)
+
+        /// @brief Returns the number of events.
+        [[nodiscard]] size_t size() const { return startTimes.size(); }
+
+        /// @brief Returns true if there are no events.
+        [[nodiscard]] bool empty() const { return startTimes.empty(); }
+
+        /// @brief Removes all events, keeping the allocated capacity.
+        void clear();
+
+        /// @brief Reserves capacity in every array.
+        void reserve(size_t count);
+
+        /// @brief Appends one event.
+        void push_back(Fraction startTime, Fraction duration, dom::StaffCmper staffId, dom::LayerIndex layerIndex, int pitch, uint8_t velocity);
+    };
+
+    /// @brief Prepares an export of a score or linked part. The staves are those of the part's scroll view.
+    /// @param document The document to export.
+    /// @param partId The score or linked part to export.
+    NoteEventStream(const dom::DocumentPtr& document, dom::Cmper partId);
+
+    /// @brief Appends the events that start in a measure, sorted by start time, then staff, layer, and pitch.
+    /// @param measureId The measure to export.
+    /// @param buffer The buffer to append to.
+    /// @param timeOffset Added to every start time in place of the measure's notated start time, if provided.
+    /// @return The number of events appended.
+    size_t appendMeasure(dom::MeasCmper measureId, EventBuffer& buffer, std::optional<Fraction> timeOffset = std::nullopt) const;
+
+    /// @brief Streams the events of every measure in order, reusing a single buffer.
+    /// @param callback Called with the measure and its events. Return false to stop.
+    /// @return False if @p callback stopped the iteration.
+    bool iterateMeasures(const std::function<bool(dom::MeasCmper, const EventBuffer&)>& callback) const;
+
+    /// @brief Exports every measure into one buffer.
+    [[nodiscard]]
+    EventBuffer calcAllEvents() const;
+
+    /// @brief Calculates the MIDI key number for a note's concert pitch.
+    ///
+    /// For EDOs other than 12 this is the nearest 12-EDO key, rounded exactly as @ref PitchTable::midiKeys.
+    [[nodiscard]]
+    static int calcMidiKey(const dom::NoteInfoPtr& noteInfo);
+
+private:
+    dom::DocumentPtr m_document;
+    dom::Cmper m_partId{};
+    std::vector<dom::StaffCmper> m_staves;
+};
+
+} // namespace musx::util
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "PitchTable.h"
+
+#include "musx/dom/Document.h"
+#include "musx/dom/Options.h"
+#include "musx/dom/Others.h"
+#include "musx/dom/Staff.h"
+
+namespace musx::util {
+
+using namespace dom;
+
+namespace {
+
+PitchTable::KeyTables createKeyTables(const MusxInstance<KeySignature>& key)
+{
+    PitchTable::KeyTables result;
+    for (unsigned step = 0; step < unsigned(music_theory::STANDARD_DIATONIC_STEPS); step++) {
+        result.keyAlterations[step] = key->calcAlterationOnNote(step, KeySignature::KeyContext::Concert);
+        result.keyAlterations[step + music_theory::STANDARD_DIATONIC_STEPS] = key->calcAlterationOnNote(step, KeySignature::KeyContext::Written);
+    }
+    result.edoDivisions = key->calcEDODivisions();
+    result.naturalKeyMap = music_theory::calcNaturalKeyMap(result.edoDivisions);
+    return result;
+}
+
+} // namespace
+
+void PitchTable::clear()
+{
+    entryNumbers.clear();
+    noteIds.clear();
+    displacements.clear();
+    alterations.clear();
+    octaves.clear();
+    midiKeys.clear();
+    staffPositions.clear();
+}
+
+void PitchTable::reserve(size_t noteCount)
+{
+    entryNumbers.reserve(noteCount);
+    noteIds.reserve(noteCount);
+    displacements.reserve(noteCount);
+    alterations.reserve(noteCount);
+    octaves.reserve(noteCount);
+    midiKeys.reserve(noteCount);
+    staffPositions.reserve(noteCount);
+}
+
+void PitchTable::appendFrame(const std::shared_ptr<const EntryFrame>& frame, const NotePropertiesOptions& options)
+{
+    if (!frame || !frame->keySignature) {
+        return;
+    }
+    const auto& key = frame->keySignature;
+    const auto clefOptions = frame->getDocumentRef().getOptions()->get<options::ClefOptions>();
+    if (!clefOptions) {
+        throw std::invalid_argument("Document contains no clef options!");
+    }
+
+    // Per-frame constants: the diatonic offset of the key's tonic from C4 in each key context.
+    const std::array<int, 2> tonicOffsets = {
+        key->calcTonalCenterIndex(KeySignature::KeyContext::Concert),
+        key->calcTonalCenterIndex(KeySignature::KeyContext::Written)
+            + key->getOctaveDisplacement(KeySignature::KeyContext::Written) * music_theory::STANDARD_DIATONIC_STEPS
+    };
+
+    // Phase 1: resolve the contextual inputs for each note.
+    const size_t start = size();
+    m_usesWrittenKey.resize(start);
+    m_clefMiddleCPositions.resize(start);
+    m_hasFixedStaffPosition.resize(start);
+    const auto& entries = frame->getEntries();
+    for (size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++) {
+        const auto& entry = entries[entryIndex]->getEntry();
+        if (!entry->isNote) {
+            continue;
+        }
+        const EntryInfoPtr entryInfo(frame, entryIndex);
+        for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+            const NoteInfoPtr noteInfo(entryInfo, noteIndex);
+            const auto& note = entry->notes[noteIndex];
+            const auto context = noteInfo.calcPitchContext(options);
+            const bool written = context.keyContext == KeySignature::KeyContext::Written;
+            int displacement = note->harmLev;
+            int alteration = note->harmAlt;
+            const auto& transposition = context.transposingStaff ? context.transposingStaff->transposition : nullptr;
+            const bool chromatic = transposition && transposition->chromatic;
+            if (context.respellEnharmonic || chromatic) {
+                const auto spelling = context.key->calcNoteSpelling(displacement, alteration, context.keyContext, context.respellEnharmonic,
+                    chromatic ? transposition->chromatic->diatonic : 0, chromatic ? transposition->chromatic->alteration : 0);
+                displacement = spelling.displacement;
+                alteration = spelling.alteration;
+            }
+            entryNumbers.push_back(entry->getEntryNumber());
+            noteIds.push_back(note->getNoteId());
+            displacements.push_back(tonicOffsets[written] + displacement);
+            alterations.push_back(alteration);
+            m_usesWrittenKey.push_back(uint8_t(written));
+            if (context.percussionNoteInfo) {
+                staffPositions.push_back(context.percussionNoteInfo->calcStaffReferencePosition());
+                m_clefMiddleCPositions.push_back(0);
+                m_hasFixedStaffPosition.push_back(1);
+            } else {
+                staffPositions.push_back(0);
+                m_clefMiddleCPositions.push_back(clefOptions->getClefDef(context.clefIndex)->middleCPos);
+                m_hasFixedStaffPosition.push_back(0);
+            }
+        }
+    }
+
+    // Phase 2: the pitch arithmetic over the new rows.
+    const size_t count = size() - start;
+    octaves.resize(size());
+    midiKeys.resize(size());
+    if (count > 0) {
+        calcPitchColumns(count, createKeyTables(key), m_usesWrittenKey.data() + start, m_clefMiddleCPositions.data() + start,
+            m_hasFixedStaffPosition.data() + start, displacements.data() + start, alterations.data() + start,
+            octaves.data() + start, midiKeys.data() + start, staffPositions.data() + start);
+    }
+}
+
+void PitchTable::appendStaff(const DocumentPtr& document, Cmper partId, StaffCmper staffId, const NotePropertiesOptions& options)
+{
+    const auto measureCount = MeasCmper(document->getOthers()->getArray<others::Measure>(partId).size());
+    for (MeasCmper measureId = 1; measureId <= measureCount; measureId++) {
+        if (const auto gfHold = details::GFrameHoldContext(document, partId, staffId, measureId)) {
+            for (LayerIndex layerIndex = 0; layerIndex < MAX_LAYERS; layerIndex++) {
+                appendFrame(gfHold.createEntryFrame(layerIndex), options);
+            }
+        }
+    }
+}
+
+void PitchTable::calcPitchColumns(size_t count, const KeyTables& tables, const uint8_t* usesWrittenKey, const int* clefMiddleCPositions,
+    const uint8_t* hasFixedStaffPosition, const int* displacements, int* alterations, int* octaves, int* midiKeys, int* staffPositions)
+{
+    constexpr int steps = music_theory::STANDARD_DIATONIC_STEPS;
+    const int edo = tables.edoDivisions;
+    for (size_t i = 0; i < count; i++) {
+        const int displacement = displacements[i];
+        const int octaveOffset = music_theory::floorDivide(displacement, steps);
+        const int step = displacement - (octaveOffset * steps);
+        const int alteration = alterations[i] + tables.keyAlterations[size_t(step + steps * usesWrittenKey[i])];
+        const int divisions = tables.naturalKeyMap[size_t(step)] + alteration + (octaveOffset * edo);
+        alterations[i] = alteration;
+        octaves[i] = octaveOffset + 4;
+        midiKeys[i] = music_theory::calcMidiKey(divisions, edo);
+        const int clefPosition = displacement + clefMiddleCPositions[i];
+        staffPositions[i] = hasFixedStaffPosition[i] ? staffPositions[i] : clefPosition;
+    }
+}
+
+} // namespace musx::util
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "musx/dom/Entries.h"
+
+namespace musx::util {
+
+/**
+ * @class PitchTable
+ * @brief Structure-of-arrays pitch data for every note in one or more entry frames.
+ *
+ * Each public column holds one element per note, in frame order: entries from left to right, then
+ * notes in the order of #dom::Entry::notes. Rests are skipped. The values match what #dom::NoteInfoPtr::calcNoteProperties
+ * returns for the same options.
+ *
+ * Filling the table has two phases. The first resolves the contextual inputs (key, clef, staff
+ * transposition, enharmonic respelling, percussion) for each note, hoisting everything that is constant
+ * within a frame. The second runs #calcPitchColumns, a branch-free pass over the columns that the compiler
+ * can auto-vectorize.
+ */
+class PitchTable
+{
+public:
+    std::vector<dom::EntryNumber> entryNumbers; ///< The entry number of each note.
+    std::vector<dom::NoteNumber> noteIds;       ///< The note ID of each note.
+    std::vector<int> displacements;             ///< Diatonic steps from C4. The note name is `positiveModulus(displacement, 7)`.
+    std::vector<int> alterations;               ///< The alteration relative to the natural note name, in EDO divisions.
+    std::vector<int> octaves;                   ///< The octave number, where middle C is C4.
+    std::vector<int> midiKeys;                  ///< The MIDI key number, where middle C is 60. For EDOs other than 12, this is the nearest 12-EDO key.
+    std::vector<int> staffPositions;            ///< The position relative to the staff reference line. (See #dom::Note::NoteProperties.)
+
+    /// @brief Per-frame constants used by #calcPitchColumns.
+    struct KeyTables
+    {
+        /// @brief The key signature alteration of each note name, C first. Elements 0-6 are concert and 7-13 are written.
+        std::array<int, 2 * music_theory::STANDARD_DIATONIC_STEPS> keyAlterations{};
+        std::array<int, music_theory::STANDARD_DIATONIC_STEPS> naturalKeyMap = music_theory::MAJOR_KEYMAP; ///< The EDO division of each natural note name.
+        int edoDivisions{ music_theory::STANDARD_12EDO_STEPS }; ///< The number of EDO divisions in the key.
+    };
+
+    /// @brief Returns the number of notes in the table.
+    [[nodiscard]]
+    size_t size() const noexcept { return entryNumbers.size(); }
+
+    /// @brief Returns true if the table has no notes.
+    [[nodiscard]]
+    bool empty() const noexcept { return entryNumbers.empty(); }
+
+    /// @brief Removes all notes from the table. Capacity is retained, so a table can be reused without reallocating.
+    void clear();
+
+    /// @brief Reserves capacity for @p noteCount notes in every column.
+    void reserve(size_t noteCount);
+
+    /// @brief Appends every note in @p frame to the table.
+    /// @param frame The entry frame to process.
+    /// @param options Calculation options, as for #dom::NoteInfoPtr::calcNoteProperties.
+    void appendFrame(const std::shared_ptr<const dom::EntryFrame>& frame, const dom::NotePropertiesOptions& options = {});
+
+    /// @brief Appends every note in every layer of a staff, measure by measure.
+    /// @param document The document to process.
+    /// @param partId The linked part to process. (Use #dom::SCORE_PARTID for the score.)
+    /// @param staffId The staff to process.
+    /// @param options Calculation options, as for #dom::NoteInfoPtr::calcNoteProperties.
+    void appendStaff(const dom::DocumentPtr& document, dom::Cmper partId, dom::StaffCmper staffId, const dom::NotePropertiesOptions& options = {});
+
+    /// @brief Creates a table for every note in @p frame.
+    [[nodiscard]]
+    static PitchTable createForFrame(const std::shared_ptr<const dom::EntryFrame>& frame, const dom::NotePropertiesOptions& options = {})
+    {
+        PitchTable result;
+        result.appendFrame(frame, options);
+        return result;
+    }
+
+    /// @brief Creates a table for every note in a staff.
+    [[nodiscard]]
+    static PitchTable createForStaff(const dom::DocumentPtr& document, dom::Cmper partId, dom::StaffCmper staffId, const dom::NotePropertiesOptions& options = {})
+    {
+        PitchTable result;
+        result.appendStaff(document, partId, staffId, options);
+        return result;
+    }
+
+    /**
+     * @brief The pitch arithmetic kernel. It has no branches or lookups outside of @p tables, so it can be vectorized.
+     *
+     * @param count The number of notes to process.
+     * @param tables The key constants for the notes.
+     * @param usesWrittenKey For each note, 1 to use the written key alterations in @p tables or 0 to use the concert ones.
+     * @param clefMiddleCPositions For each note, the staff position of middle C in its clef.
+     * @param hasFixedStaffPosition For each note, 1 if @p staffPositions already holds a fixed position (e.g., percussion).
+     * @param displacements For each note, diatonic steps from C4.
+     * @param alterations On input, the key-relative alteration of each note. On output, the alteration relative to the natural note name.
+     * @param octaves Output octave numbers.
+     * @param midiKeys Output MIDI key numbers.
+     * @param staffPositions Output staff positions. Elements with @p hasFixedStaffPosition set are left unchanged.
+     */
+    static void calcPitchColumns(size_t count, const KeyTables& tables, const uint8_t* usesWrittenKey, const int* clefMiddleCPositions,
+        const uint8_t* hasFixedStaffPosition, const int* displacements, int* alterations, int* octaves, int* midiKeys, int* staffPositions);
+
+private:
+    // scratch columns for the kernel, retained to avoid reallocation
+    std::vector<uint8_t> m_usesWrittenKey;
+    std::vector<int> m_clefMiddleCPositions;
+    std::vector<uint8_t> m_hasFixedStaffPosition;
+};
+
+} // namespace musx::util
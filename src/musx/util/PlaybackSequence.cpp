@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "musx/util/PlaybackSequence.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+#include "musx/musx.h"
+
+namespace musx::util {
+
+using namespace dom;
+
+PlaybackSequence::PlaybackSequence(const DocumentPtr& document, Cmper partId)
+{
+    const auto& others = *document->getOthers();
+    const auto measures = others.getArray<others::Measure>(partId);
+    MeasCmper measureCount = 0;
+    for (const auto& measure : measures) {
+        measureCount = (std::max)(measureCount, MeasCmper(measure->getCmper()));
+    }
+    m_measures.resize(size_t(measureCount));
+    const auto isValidMeasure = [&](Cmper measureId) {
+        return measureId >= 1 && measureId <= measureCount;
+    };
+    for (const auto& measure : measures) {
+        if (isValidMeasure(measure->getCmper())) {
+            m_measures[size_t(measure->getCmper()) - 1].forwardRepeat = measure->forwardRepeatBar;
+        }
+    }
+
+    for (const auto& repeatBack : others.getArray<others::RepeatBack>(partId)) {
+        if (isValidMeasure(repeatBack->getCmper())) {
+            auto& repeats = m_measures[size_t(repeatBack->getCmper()) - 1];
+            repeats.repeatBack = repeatBack;
+            repeats.repeatBackTarget = repeatBack->calcTargetMeasure();
+        }
+    }
+
+    for (const auto& ending : others.getArray<others::RepeatEndingStart>(partId)) {
+        if (isValidMeasure(ending->getCmper())) {
+            auto& repeats = m_measures[size_t(ending->getCmper()) - 1];
+            repeats.ending = ending;
+            repeats.endingTarget = ending->calcTargetMeasure();
+            if (const auto passList = others.get<others::RepeatPassList>(partId, ending->getCmper())) {
+                repeats.endingPasses = passList->values;
+            }
+        }
+    }
+    for (auto& repeats : m_measures) {
+        if (repeats.ending) {
+            const auto target = repeats.endingTarget;
+            repeats.isLastEnding = !target || !isValidMeasure(*target) || !m_measures[size_t(*target) - 1].ending;
+        }
+    }
+
+    // Resolve JumpToMark targets from a single scan rather than per assignment.
+    const auto textRepeats = others.getArray<others::TextRepeatAssign>(partId);
+    std::unordered_map<Cmper, MeasCmper> markMeasures;
+    for (const auto& assign : textRepeats) {
+        markMeasures.emplace(assign->textRepeatId, assign->getCmper());
+    }
+    for (const auto& assign : textRepeats) {
+        if (!isValidMeasure(assign->getCmper())) {
+            continue;
+        }
+        TextRepeat textRepeat{ assign, {}, std::nullopt };
+        if (assign->jumpAction == others::RepeatActionType::JumpToMark) {
+            if (const auto it = markMeasures.find(Cmper(assign->targetValue)); it != markMeasures.end()) {
+                textRepeat.target = it->second;
+            }
+        } else {
+            textRepeat.target = assign->calcTargetMeasure();
+        }
+        if (assign->jumpOnMultiplePasses) {
+            if (const auto def = others.get<others::TextRepeatDef>(partId, assign->textRepeatId)) {
+                textRepeat.passList = def->passList;
+            }
+        }
+        m_measures[size_t(assign->getCmper()) - 1].textRepeats.push_back(std::move(textRepeat));
+    }
+
+    reset();
+}
+
+void PlaybackSequence::reset()
+{
+    m_current = m_measures.empty() ? 0 : 1;
+    m_pass = 1;
+    m_ignoringRepeats = false;
+    m_jumped = false;
+    m_steps = 0;
+    m_repeatBackCounts.assign(m_measures.size(), 0);
+    m_textRepeatCounts.clear();
+}
+
+void PlaybackSequence::resetRepeatCounts()
+{
+    std::fill(m_repeatBackCounts.begin(), m_repeatBackCounts.end(), 0);
+}
+
+void PlaybackSequence::jumpTo(MeasCmper measureId)
+{
+    m_current = (measureId >= 1 && measureId <= getMeasureCount()) ? measureId : 0;
+    m_jumped = true;
+}
+
+bool PlaybackSequence::calcSkipsEnding(const MeasureRepeats& repeats) const
+{
+    if (!repeats.ending || !repeats.endingTarget) {
+        return false;
+    }
+    if (m_ignoringRepeats) {
+        return repeats.ending->jumpIfIgnoring || !repeats.isLastEnding;
+    }
+    if (repeats.endingPasses.empty()) {
+        return false;
+    }
+    return std::find(repeats.endingPasses.begin(), repeats.endingPasses.end(), m_pass) == repeats.endingPasses.end();
+}
+
+void PlaybackSequence::advanceFrom(MeasCmper measureId)
+{
+    const auto& repeats = m_measures[size_t(measureId) - 1];
+
+    if (repeats.repeatBack && !m_ignoringRepeats) {
+        const auto& repeatBack = *repeats.repeatBack;
+        const int count = ++m_repeatBackCounts[size_t(measureId) - 1];
+        const int passes = repeatBack.passNumber > 0 ? repeatBack.passNumber : 2;
+        const bool fires = repeatBack.trigger == others::RepeatTriggerType::OnPass ? count == passes : count < passes;
+        if (fires) {
+            if (repeatBack.jumpAction == others::RepeatActionType::Stop) {
+                m_current = 0;
+                return;
+            }
+            if (repeats.repeatBackTarget) {
+                ++m_pass;
+                jumpTo(*repeats.repeatBackTarget);
+                return;
+            }
+        }
+    }
+
+    for (const auto& textRepeat : repeats.textRepeats) {
+        const auto& assign = *textRepeat.assign;
+        const int count = ++m_textRepeatCounts[{ measureId, assign.getInci().value_or(0) }];
+        bool fires = false;
+        if (m_ignoringRepeats && assign.jumpIfIgnoring) {
+            fires = true;
+        } else if (assign.jumpOnMultiplePasses) {
+            fires = std::find(textRepeat.passList.begin(), textRepeat.passList.end(), count) != textRepeat.passList.end();
+        } else {
+            switch (assign.trigger) {
+            case others::RepeatTriggerType::OnPass: fires = count == assign.passNumber; break;
+            case others::RepeatTriggerType::UntilPass: fires = count < assign.passNumber; break;
+            case others::RepeatTriggerType::Always: fires = count == 1; break;
+            }
+        }
+        if (!fires) {
+            continue;
+        }
+        if (assign.jumpAction == others::RepeatActionType::Stop) {
+            m_current = 0;
+            return;
+        }
+        if (textRepeat.target) {
+            if (assign.resetOnAction) {
+                resetRepeatCounts();
+                m_ignoringRepeats = false;
+            } else {
+                m_ignoringRepeats = true;
+            }
+            m_pass = 1;
+            jumpTo(*textRepeat.target);
+            return;
+        }
+    }
+
+    m_current = measureId < getMeasureCount() ? MeasCmper(measureId + 1) : 0;
+    m_jumped = false;
+}
+
+std::optional<PlaybackSequence::Step> PlaybackSequence::next()
+{
+    // Skip endings that are not played on this pass. Each skip moves to another measure, so more skips than
+    // there are measures means the endings form a cycle.
+    for (size_t skips = 0; m_current && calcSkipsEnding(m_measures[size_t(m_current) - 1]); skips++) {
+        if (skips >= m_measures.size()) {
+            util::Logger::log(util::Logger::LogLevel::Warning, [&]() {
+                return "Repeat endings form a cycle at measure " + std::to_string(m_current) + ". Playback stopped.";
+            });
+            m_current = 0;
+            break;
+        }
+        jumpTo(*m_measures[size_t(m_current) - 1].endingTarget);
+    }
+    if (!m_current) {
+        return std::nullopt;
+    }
+    if (++m_steps > MAX_PLAYS_PER_MEASURE * m_measures.size()) {
+        util::Logger::log(util::Logger::LogLevel::Warning, [&]() {
+            return "Playback exceeded " + std::to_string(m_steps - 1) + " measures without ending. Playback stopped.";
+        });
+        m_current = 0;
+        return std::nullopt;
+    }
+
+    const MeasCmper measureId = m_current;
+    if (!m_jumped && m_measures[size_t(measureId) - 1].forwardRepeat) {
+        m_pass = 1; // entering a new repeated section
+    }
+    const Step result{ measureId, m_pass };
+    advanceFrom(measureId);
+    return result;
+}
+
+std::vector<PlaybackSequence::Step> PlaybackSequence::calcAll(const DocumentPtr& document, Cmper partId)
+{
+    PlaybackSequence sequence(document, partId);
+    std::vector<Step> result;
+    result.reserve(size_t(sequence.getMeasureCount()));
+    while (const auto step = sequence.next()) {
+        result.push_back(*step);
+    }
+    return result;
+}
+
+} // namespace musx::util
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "musx/dom/BaseClasses.h"
+#include "musx/dom/Others.h"
+
+namespace musx::util {
+
+/**
+ * @class PlaybackSequence
+ * @brief Unrolls the repeat structure of a score or linked part into the order in which measures are played.
+ *
+ * The repeat elements (@ref dom::others::RepeatBack, @ref dom::others::RepeatEndingStart with its
+ * @ref dom::others::RepeatPassList, and @ref dom::others::TextRepeatAssign with its @ref dom::others::TextRepeatDef)
+ * are scanned once at construction into per-measure tables. Playback is then produced one measure at a time by #next,
+ * so long scores with many repeats never need the whole unrolled sequence in memory. Use #calcAll when the complete
+ * list is wanted.
+ *
+ * The interpretation follows Finale's playback model as closely as the stored data allows:
+ * - A repeat-back jumps until the section has been played @ref dom::others::RepeatBack::passNumber times
+ *   (or jumps only on that pass if its trigger is @ref dom::others::RepeatTriggerType::OnPass).
+ * - An ending is skipped when the current pass is not in its pass list.
+ * - A text repeat jumps on the passes given by its trigger. An "always" text repeat jumps once per counter reset,
+ *   which keeps D.C. and D.S. jumps from looping forever.
+ * - After a text repeat jump without "Reset on Repeat Action", repeats are ignored: repeat-backs no longer jump and
+ *   only the last ending of each group (or none, if it is marked "Skip Ending if Ignoring Repeats") is played.
+ *
+ * As a safeguard against malformed repeat structures, playback stops with a warning after
+ * #MAX_PLAYS_PER_MEASURE times the number of measures.
+ */
+class PlaybackSequence
+{
+public:
+    /// @brief One measure in the playback order.
+    struct Step
+    {
+        dom::MeasCmper measureId{};  ///< The measure being played.
+        int pass{1};                 ///< The 1-based pass through the current repeated section.
+
+        /// @brief Equality comparison operator.
+        bool operator==(const Step& other) const
+        { return measureId == other.measureId && pass == other.pass; }
+    };
+
+    /// @brief The maximum average number of times a measure may be played before playback is abandoned.
+    static constexpr size_t MAX_PLAYS_PER_MEASURE = 64;
+
+    /// @brief Scans the repeat structure of a score or linked part.
+    /// @param document The document.
+    /// @param partId The score or linked part whose repeats to unroll.
+    PlaybackSequence(const dom::DocumentPtr& document, dom::Cmper partId);
+
+    /// @brief Returns the next measure in the playback order, or std::nullopt when playback has finished.
+    [[nodiscard]]
+    std::optional<Step> next();
+
+    /// @brief Restarts playback from the first measure.
+    void reset();
+
+    /// @brief Returns the number of measures in the part.
+    [[nodiscard]]
+    dom::MeasCmper getMeasureCount() const { return dom::MeasCmper(m_measures.size()); }
+
+    /// @brief Unrolls the complete playback order from the first measure.
+    /// @param document The document.
+    /// @param partId The score or linked part whose repeats to unroll.
+    [[nodiscard]]
+    static std::vector<Step> calcAll(const dom::DocumentPtr& document, dom::Cmper partId);
+
+private:
+    /// @brief A text repeat assignment with its resolved target.
+    struct TextRepeat
+    {
+        dom::MusxInstance<dom::others::TextRepeatAssign> assign;
+        std::vector<int> passList;                  ///< From the @ref dom::others::TextRepeatDef when it jumps on multiple passes.
+        std::optional<dom::MeasCmper> target;
+    };
+
+    /// @brief The repeat elements of a single measure.
+    struct MeasureRepeats
+    {
+        bool forwardRepeat{};
+        dom::MusxInstance<dom::others::RepeatBack> repeatBack;
+        std::optional<dom::MeasCmper> repeatBackTarget;
+        dom::MusxInstance<dom::others::RepeatEndingStart> ending;
+        std::vector<int> endingPasses;              ///< Empty if the ending applies to every pass.
+        std::optional<dom::MeasCmper> endingTarget;
+        bool isLastEnding{};                        ///< True if no other ending starts at #endingTarget.
+        std::vector<TextRepeat> textRepeats;        ///< In inci order.
+    };
+
+    bool calcSkipsEnding(const MeasureRepeats& repeats) const;
+    void advanceFrom(dom::MeasCmper measureId);     ///< Applies the repeat elements at the end of a measure to choose the next one.
+    void jumpTo(dom::MeasCmper measureId);          ///< Jumps to a measure, ending playback if it is out of range.
+    void resetRepeatCounts();
+
+    std::vector<MeasureRepeats> m_measures;         ///< Indexed by measure id - 1.
+
+    // playback state
+    dom::MeasCmper m_current{};                     ///< The next measure to play, or 0 when finished.
+    int m_pass{1};
+    bool m_ignoringRepeats{};
+    bool m_jumped{};                                ///< True if #m_current was reached by a jump.
+    size_t m_steps{};
+    std::vector<int> m_repeatBackCounts;            ///< Indexed by measure id - 1.
+    std::map<std::pair<dom::MeasCmper, dom::Inci>, int> m_textRepeatCounts;
+};
+
+} // namespace musx::util
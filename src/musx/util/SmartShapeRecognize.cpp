@@ -122,7 +122,7 @@ KnownSmartShapeType recognizeSmartShape(const SmartShape& smartShape)
     if (smartShape.shapeType != SmartShape::ShapeType::CustomLine || smartShape.lineStyleId == 0) {
         return KnownSmartShapeType::Unrecognized;
     }
-    const auto customShape = smartShape.getDocument()->getOthers()->get<CL>(smartShape.getRequestedPartId(), smartShape.lineStyleId);
+    const auto customShape = smartShape.getDocumentRef().getOthers()->get<CL>(smartShape.getRequestedPartId(), smartShape.lineStyleId);
     if (!customShape) {
         Logger::log(Logger::LogLevel::Warning, "Unable to find custom shape for smart shape " + std::to_string(smartShape.getCmper()));
         return KnownSmartShapeType::Unrecognized;
@@ -139,7 +139,7 @@ KnownSmartShapeType recognizeSmartShape(const SmartShape& smartShape)
                 if (smartShape.startTermSeg->endPointAdj->calcHorzOffset() != smartShape.endTermSeg->endPointAdj->calcHorzOffset()) {
                     return KnownSmartShapeType::Unrecognized;
                 }
-                const auto scrollView = smartShape.getDocument()->getScrollViewStaves(smartShape.getRequestedPartId());
+                const auto scrollView = smartShape.getDocumentRef().getScrollViewStaves(smartShape.getRequestedPartId());
                 const auto startStaffIndex = scrollView.getIndexForStaff(smartShape.startTermSeg->endPoint->staffId);
                 const auto endStaffIndex = scrollView.getIndexForStaff(smartShape.endTermSeg->endPoint->staffId);
                 if (!startStaffIndex || !endStaffIndex) {
@@ -2740,7 +2740,7 @@ std::string SvgConvert::toSvgWithPageFormatScaling(const dom::others::ShapeDef&
                                                    SvgUnit unit,
                                                    GlyphMetricsFn glyphMetrics)
 {
-    const auto options = shape.getDocument()->getOptions()->get<dom::options::PageFormatOptions>();
+    const auto options = shape.getDocumentRef().getOptions()->get<dom::options::PageFormatOptions>();
     MUSX_ASSERT_IF(!options) {
         throw std::invalid_argument("PageFormatOptions are not available on this Document.");
     }
@@ -143,7 +143,7 @@ bool calcUseAfterSingleDot(const NoteInfoPtr& noteInfo, bool forTieEnd, const No
             return tieAlter->afterSingleDotOn;
         }
     }
-    if (const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>()) {
+    if (const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>()) {
         return tieOptions->afterSingleDot;
     }
     return false;
@@ -157,7 +157,7 @@ bool calcUseAfterMultipleDots(const NoteInfoPtr& noteInfo, bool forTieEnd, const
             return tieAlter->afterMultiDotsOn;
         }
     }
-    if (const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>()) {
+    if (const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>()) {
         return tieOptions->afterMultipleDots;
     }
     return false;
@@ -171,7 +171,7 @@ bool calcUseBeforeSingleAcci(const NoteInfoPtr& noteInfo, bool forTieEnd, const
             return tieAlter->beforeSingleAcciOn;
         }
     }
-    if (const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>()) {
+    if (const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>()) {
         return tieOptions->beforeAcciSingleNote;
     }
     return false;
@@ -185,7 +185,7 @@ bool calcShiftForSeconds(const NoteInfoPtr& noteInfo, bool forTieEnd, const Note
             return tieAlter->shiftForSecondsOn;
         }
     }
-    if (const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>()) {
+    if (const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>()) {
         return tieOptions->secondsPlacement == options::TieOptions::SecondsPlacement::ShiftForSeconds;
     }
     return false;
@@ -199,7 +199,7 @@ bool calcUseOuterPlacement(const NoteInfoPtr& noteInfo, bool forTieEnd, const No
             return tieAlter->outerOn;
         }
     }
-    if (const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>()) {
+    if (const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>()) {
         return tieOptions->useOuterPlacement;
     }
     return true;
@@ -291,7 +291,7 @@ Evpu calcEndpointOffsetX(const NoteInfoPtr& noteInfo, bool forTieEnd, bool forEn
     if (!noteInfo) {
         return defaultOffset.offsetX;
     }
-    const auto tieOptions = noteInfo.getEntryInfo().getFrame()->getDocument()->getOptions()->get<options::TieOptions>();
+    const auto tieOptions = noteInfo.getEntryInfo().getFrame()->getDocumentRef().getOptions()->get<options::TieOptions>();
     if (!tieOptions) {
         return defaultOffset.offsetX;
     }
@@ -331,7 +331,7 @@ CurveContourDirection Tie::calcDefaultDirection(const dom::NoteInfoPtr& noteInfo
         }
     }
 
-    const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>();
+    const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>();
     size_t noteCount = entryInfo->getEntry()->notes.size();
     const bool upStem = entryInfo.calcUpStem();
 
@@ -471,7 +471,7 @@ CurveContourDirection Tie::calcEffectiveDirection(const dom::NoteInfoPtr& noteIn
         return entryInfo.calcUpStem() ? CurveContourDirection::Up : CurveContourDirection::Down;
     }
 
-    const auto scrollViewStaves = entryFrame->getDocument()->getScrollViewStaves(entryFrame->getRequestedPartId());
+    const auto scrollViewStaves = entryFrame->getDocumentRef().getScrollViewStaves(entryFrame->getRequestedPartId());
     const int crossStaffDir = noteInfo.calcCrossStaffDirection(scrollViewStaves);
     if (crossStaffDir != 0) {
         return (crossStaffDir > 0) ? CurveContourDirection::Up : CurveContourDirection::Down;
@@ -778,7 +778,7 @@ options::TieOptions::ConnectStyle Tie::calcEndpointOffsets(const dom::NoteInfoPt
         return defaultOffset;
     }
     const auto entryFrame = noteInfo.getEntryInfo().getFrame();
-    const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>();
+    const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>();
     if (!tieOptions) {
         return defaultOffset;
     }
@@ -814,7 +814,7 @@ std::optional<Tie::ContourResult> Tie::calcContourStyleType(
     }
 
     const auto entryFrame = noteInfo.getEntryInfo().getFrame();
-    const auto tieOptions = entryFrame->getDocument()->getOptions()->get<options::TieOptions>();
+    const auto tieOptions = entryFrame->getDocumentRef().getOptions()->get<options::TieOptions>();
     if (!tieOptions) {
         return std::nullopt;
     }
@@ -896,7 +896,7 @@ std::optional<Tie::ContourControlPoints> Tie::calcDefaultContourControlPoints(
         return std::nullopt;
     }
 
-    const auto tieOptions = noteInfo.getEntryInfo().getFrame()->getDocument()->getOptions()->get<options::TieOptions>();
+    const auto tieOptions = noteInfo.getEntryInfo().getFrame()->getDocumentRef().getOptions()->get<options::TieOptions>();
     if (!tieOptions) {
         return std::nullopt;
     }
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "musx/util/Fraction.h"
+
+namespace {
+
+using musx::util::Fraction;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t operandCount = 4'096;
+constexpr std::size_t passesPerSample = 64;
+constexpr std::size_t warmupSampleCount = 5;
+constexpr std::size_t measuredSampleCount = 25;
+constexpr int outputPrecision = 2;
+constexpr int failureExitCode = 1;
+
+/// Reference implementation of the previous gcd-always int arithmetic, used as the baseline.
+struct GcdFraction
+{
+    int num = 0;
+    int den = 1;
+
+    GcdFraction() = default;
+    GcdFraction(int n, int d)
+    {
+        const int gcd = std::gcd(n, d);
+        num = n / gcd;
+        den = d / gcd;
+        if (den < 0) {
+            num = -num;
+            den = -den;
+        }
+    }
+
+    GcdFraction operator+(const GcdFraction& other) const
+    { return GcdFraction(num * other.den + other.num * den, den * other.den); }
+
+    GcdFraction operator*(const GcdFraction& other) const
+    { return GcdFraction(num * other.num, den * other.den); }
+
+    bool operator<(const GcdFraction& other) const
+    { return double(num) / den < double(other.num) / other.den; }
+};
+
+/// Operands shaped like entry durations: mostly binary Edu values with occasional tuplet ratios.
+std::vector<std::pair<int, int>> makeOperands(bool includeTuplets)
+{
+    static constexpr int binaryEdus[] = { 256, 512, 768, 1024, 1536, 2048, 3072, 4096 };
+    static constexpr std::pair<int, int> tupletRatios[] = { {2, 3}, {4, 5}, {4, 6}, {8, 7} };
+
+    std::vector<std::pair<int, int>> result;
+    result.reserve(operandCount);
+    std::uint32_t state = 12345;
+    for (std::size_t index = 0; index < operandCount; ++index) {
+        state = state * 1664525u + 1013904223u;
+        const int edu = binaryEdus[(state >> 8) % std::size(binaryEdus)];
+        if (includeTuplets && (state >> 20) % 4 == 0) {
+            const auto [num, den] = tupletRatios[(state >> 24) % std::size(tupletRatios)];
+            result.emplace_back(edu * num, musx::dom::EDU_PER_WHOLE_NOTE * den);
+        } else {
+            result.emplace_back(edu, musx::dom::EDU_PER_WHOLE_NOTE);
+        }
+    }
+    return result;
+}
+
+template <typename FractionType>
+std::chrono::nanoseconds runSample(const std::vector<std::pair<int, int>>& operands, std::int64_t& checksum)
+{
+    std::vector<FractionType> values;
+    values.reserve(operands.size());
+    for (const auto& [num, den] : operands) {
+        values.emplace_back(num, den);
+    }
+
+    const auto start = Clock::now();
+    std::int64_t local = 0;
+    for (std::size_t pass = 0; pass < passesPerSample; ++pass) {
+        // Elapsed durations restart each measure so the running sum stays within int.
+        FractionType elapsed(0, 1);
+        FractionType previous(0, 1);
+        for (std::size_t index = 0; index < values.size(); ++index) {
+            if (index % 16 == 0) {
+                elapsed = FractionType(0, 1);
+            }
+            const auto actual = values[index] * FractionType(1, 1);
+            elapsed = elapsed + actual;
+            local += (previous < actual) ? 1 : 0;
+            previous = actual;
+        }
+        local += int(elapsed < FractionType(1, 1));
+    }
+    const auto end = Clock::now();
+    checksum += local;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+}
+
+template <typename FractionType>
+std::vector<std::chrono::nanoseconds> measure(const std::vector<std::pair<int, int>>& operands, std::int64_t& checksum)
+{
+    for (std::size_t sample = 0; sample < warmupSampleCount; ++sample) {
+        static_cast<void>(runSample<FractionType>(operands, checksum));
+    }
+    std::vector<std::chrono::nanoseconds> samples;
+    samples.reserve(measuredSampleCount);
+    for (std::size_t sample = 0; sample < measuredSampleCount; ++sample) {
+        samples.push_back(runSample<FractionType>(operands, checksum));
+    }
+    return samples;
+}
+
+void printSummary(const std::string& name, std::vector<std::chrono::nanoseconds> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const auto minimum = samples.front().count();
+    const auto median = samples[samples.size() / 2].count();
+    const auto p90 = samples[(samples.size() - 1) * 90 / 100].count();
+    const auto perOperation = static_cast<double>(median) / double(operandCount * passesPerSample);
+
+    std::cout << name
+              << ": min=" << minimum << " ns"
+              << " median=" << median << " ns"
+              << " p90=" << p90 << " ns"
+              << " median_per_step=" << std::fixed << std::setprecision(outputPrecision)
+              << perOperation << " ns\n";
+}
+
+void verifyAgreement(const std::vector<std::pair<int, int>>& operands)
+{
+    Fraction sum;
+    GcdFraction baseline;
+    for (std::size_t index = 0; index < 16 && index < operands.size(); ++index) {
+        sum += Fraction(operands[index].first, operands[index].second);
+        baseline = baseline + GcdFraction(operands[index].first, operands[index].second);
+    }
+    if (sum.numerator() != baseline.num || sum.denominator() != baseline.den) {
+        throw std::runtime_error("Fraction and baseline disagree");
+    }
+}
+
+} // namespace
+
+int main()
+{
+    try {
+        std::int64_t checksum = 0;
+        const auto binaryOperands = makeOperands(false);
+        const auto mixedOperands = makeOperands(true);
+        verifyAgreement(binaryOperands);
+        verifyAgreement(mixedOperands);
+
+        std::cout << "operands=" << operandCount
+                  << " passes=" << passesPerSample
+                  << " warmups=" << warmupSampleCount
+                  << " samples=" << measuredSampleCount << '\n';
+        printSummary("binary_gcd_baseline", measure<GcdFraction>(binaryOperands, checksum));
+        printSummary("binary_fraction", measure<Fraction>(binaryOperands, checksum));
+        printSummary("mixed_gcd_baseline", measure<GcdFraction>(mixedOperands, checksum));
+        printSummary("mixed_fraction", measure<Fraction>(mixedOperands, checksum));
+        std::cout << "checksum=" << checksum << '\n';
+    } catch (const std::exception& error) {
+        std::cerr << "fraction benchmark failed: " << error.what() << '\n';
+        return failureExitCode;
+    }
+    return 0;
+}
@@ -20,17 +20,45 @@
  * THE SOFTWARE.
 */
 
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <new>
 #include <random>
 
 #include "musx/musx.h"
 
 using namespace musx::dom;
 
+// count heap traffic so that the memory report can attribute allocations to document loading
+static std::atomic<size_t> g_allocationCount{};
+static std::atomic<size_t> g_allocationBytes{};
+
+void* operator new(std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* result = std::malloc(size ? size : 1)) {
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
 // provide access to the raw others pool
 namespace bench {
 template<>
@@ -83,15 +111,71 @@ DocumentPtr loadDocument(const std::vector<char>& buffer)
         std::cout << "Loaded enigmaxml with rapidxml in " << duration(loadMs) << "\n";
     }
     {
+        const size_t countBefore = g_allocationCount.load();
+        const size_t bytesBefore = g_allocationBytes.load();
+        auto profile = std::make_shared<musx::factory::LoadProfile>();
+        profile->allocationCounter = []() { return g_allocationCount.load(); };
+        musx::factory::DocumentFactory::CreateOptions createOptions;
+        createOptions.profile = profile;
         auto loadPugiStart = clock::now();
-        auto docPugi = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(buffer);
+        auto docPugi = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(buffer, std::move(createOptions));
         auto loadPugiEnd = clock::now();
         auto loadMs = loadPugiEnd - loadPugiStart;
         std::cout << "Loaded enigmaxml with pugi in " << duration(loadMs) << "\n";
+        std::cout << "  " << (g_allocationCount.load() - countBefore) << " heap allocations totaling "
+                  << (g_allocationBytes.load() - bytesBefore) / 1024 << " KiB (including the xml parse tree)\n";
+
+        // the slowest phases of the profiled load
+        constexpr size_t maxPhasesToShow = 12;
+        auto phases = profile->phases;
+        std::sort(phases.begin(), phases.end(), [](const auto& a, const auto& b) { return a.duration > b.duration; });
+        phases.resize(std::min(phases.size(), maxPhasesToShow));
+        for (const auto& phase : phases) {
+            std::cout << "    " << phase.name << ": " << duration(phase.duration);
+            if (phase.allocations) {
+                std::cout << " (" << *phase.allocations << " allocations)";
+            }
+            std::cout << "\n";
+        }
         return docPugi;
     }
 }
 
+void reportMemoryUsage(const DocumentPtr& doc)
+{
+    const auto& entryPool = bench::PoolAccessor<EntryPool>::get(*doc->getEntries());
+
+    // estimate the retained footprint of entries and notes: object size plus the shared_ptr control block
+    // (allocated together by make_shared), the notes vector, and the hash node that holds the entry
+    constexpr size_t controlBlockBytes = 2 * sizeof(long);
+    constexpr size_t hashNodeBytes = sizeof(void*) + sizeof(size_t) + sizeof(std::pair<const EntryNumber, std::shared_ptr<Entry>>);
+
+    size_t noteCount = 0;
+    size_t entryBytes = entryPool.bucket_count() * sizeof(void*);
+    size_t noteBytes = 0;
+    for (const auto& [entryNumber, entry] : entryPool) {
+        (void)entryNumber;
+        entryBytes += sizeof(Entry) + controlBlockBytes + hashNodeBytes;
+        entryBytes += entry->notes.capacity() * sizeof(std::shared_ptr<Note>);
+        noteCount += entry->notes.size();
+        noteBytes += entry->notes.size() * (sizeof(Note) + controlBlockBytes);
+    }
+
+    const size_t entryCount = entryPool.size();
+    std::cout << "Memory usage:\n";
+    std::cout << "  sizeof(Entry) = " << sizeof(Entry) << " bytes, sizeof(Note) = " << sizeof(Note) << " bytes\n";
+    std::cout << "  " << entryCount << " entries retain about " << entryBytes / 1024 << " KiB";
+    if (entryCount) {
+        std::cout << " (" << entryBytes / entryCount << " bytes per entry)";
+    }
+    std::cout << "\n";
+    std::cout << "  " << noteCount << " notes retain about " << noteBytes / 1024 << " KiB";
+    if (noteCount) {
+        std::cout << " (" << noteBytes / noteCount << " bytes per note)";
+    }
+    std::cout << "\n";
+}
+
 void adHocTest([[maybe_unused]]const DocumentPtr& doc)
 {
 /*
@@ -420,6 +504,7 @@ int main(int argc, char* argv[])
     auto partDefs = others::PartDefinition::getInUserOrder(doc);
 
     adHocTest(doc);
+    reportMemoryUsage(doc);
     traverseEntries(doc);
     benchmarkEntries(doc);
     benchmarkOthersArrays(doc, SCORE_PARTID);
@@ -0,0 +1,453 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "musx/musx.h"
+#include "score_generator.h"
+
+#ifndef MUSX_BENCH_DATA_DIR
+#define MUSX_BENCH_DATA_DIR "tests/data"
+#endif
+
+namespace {
+
+using namespace musx::dom;
+using Clock = std::chrono::steady_clock;
+using Xml = musx::xml::rapidxml::Document;
+
+constexpr std::size_t defaultWarmupSampleCount = 3;
+constexpr std::size_t defaultMeasuredSampleCount = 15;
+constexpr int outputPrecision = 1;
+constexpr int failureExitCode = 1;
+
+/// The fixtures measured when no files are given on the command line, largest first.
+/// multistaff_inst keeps its music on a staff outside the scroll view, so it measures load and part context only.
+constexpr std::string_view defaultFixtures[] = {
+    "nonArpeggios.enigmaxml",
+    "hidden_keysigs.enigmaxml",
+    "trill-to.enigmaxml",
+    "multistaff_inst.enigmaxml",
+    "ties.enigmaxml",
+    "beam_over_graces.enigmaxml",
+};
+
+/// The options and fonts borrowed by synthetic scores: those of a new default document.
+constexpr std::string_view syntheticOptionsFixture = "finale_maestro_default.enigmaxml";
+
+struct Settings
+{
+    std::size_t warmupSampleCount = defaultWarmupSampleCount;
+    std::size_t measuredSampleCount = defaultMeasuredSampleCount;
+    std::string filter;
+    std::filesystem::path jsonPath;
+    std::vector<std::filesystem::path> fixtures;
+    std::optional<musxtest::ScoreSpec> synthetic;   ///< Set by --synthetic or any of the score shape options.
+};
+
+/// One benchmark over one fixture. Each sample runs the whole workload once.
+struct Result
+{
+    std::string fixture;
+    std::string benchmark;
+    std::size_t operations{};   ///< The number of items processed by one sample.
+    std::vector<std::chrono::nanoseconds> samples;  ///< Sorted ascending.
+
+    [[nodiscard]] std::int64_t percentile(unsigned percent) const
+    { return samples[(samples.size() - 1) * percent / 100].count(); }
+
+    [[nodiscard]] std::int64_t mean() const
+    {
+        std::chrono::nanoseconds total{};
+        for (const auto& sample : samples) {
+            total += sample;
+        }
+        return total.count() / static_cast<std::int64_t>(samples.size());
+    }
+
+    [[nodiscard]] double perOperation() const
+    { return operations ? static_cast<double>(percentile(50)) / static_cast<double>(operations) : 0.0; }
+};
+
+[[noreturn]] void fail(const std::string& message)
+{
+    throw std::runtime_error(message);
+}
+
+std::vector<char> readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        fail("unable to open " + path.string());
+    }
+    const std::streamsize size = file.tellg();
+    if (size < 0) {
+        fail("unable to determine the size of " + path.string());
+    }
+    file.seekg(0, std::ios::beg);
+    std::vector<char> buffer(static_cast<std::size_t>(size));
+    if (!file.read(buffer.data(), size)) {
+        fail("unable to read " + path.string());
+    }
+    return buffer;
+}
+
+class Suite
+{
+public:
+    explicit Suite(const Settings& settings) : m_settings(settings) {}
+
+    /// Runs @p workload for the warmup and measured samples. The workload returns the number of items it processed.
+    void run(const std::string& fixture, const std::string& benchmark, const std::function<std::size_t()>& workload)
+    {
+        if (!m_settings.filter.empty() && benchmark.find(m_settings.filter) == std::string::npos) {
+            return;
+        }
+        Result result;
+        result.fixture = fixture;
+        result.benchmark = benchmark;
+        for (std::size_t sample = 0; sample < m_settings.warmupSampleCount; ++sample) {
+            result.operations = workload();
+        }
+        result.samples.reserve(m_settings.measuredSampleCount);
+        for (std::size_t sample = 0; sample < m_settings.measuredSampleCount; ++sample) {
+            const auto start = Clock::now();
+            const std::size_t operations = workload();
+            const auto end = Clock::now();
+            if (sample != 0 && operations != result.operations) {
+                fail(benchmark + " processed a different number of items on repeated runs");
+            }
+            result.operations = operations;
+            result.samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+        }
+        std::sort(result.samples.begin(), result.samples.end());
+        print(result);
+        m_results.push_back(std::move(result));
+    }
+
+    void writeJson(std::ostream& out) const
+    {
+        out << "{\n";
+        out << "  \"warmups\": " << m_settings.warmupSampleCount << ",\n";
+        out << "  \"samples\": " << m_settings.measuredSampleCount << ",\n";
+        out << "  \"results\": [";
+        for (std::size_t index = 0; index < m_results.size(); ++index) {
+            const auto& result = m_results[index];
+            out << (index ? ",\n" : "\n");
+            out << "    {\"fixture\": " << quoted(result.fixture)
+                << ", \"benchmark\": " << quoted(result.benchmark)
+                << ", \"operations\": " << result.operations
+                << ", \"min_ns\": " << result.samples.front().count()
+                << ", \"p50_ns\": " << result.percentile(50)
+                << ", \"p90_ns\": " << result.percentile(90)
+                << ", \"p99_ns\": " << result.percentile(99)
+                << ", \"max_ns\": " << result.samples.back().count()
+                << ", \"mean_ns\": " << result.mean()
+                << ", \"p50_ns_per_op\": " << std::fixed << std::setprecision(outputPrecision) << result.perOperation()
+                << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+private:
+    static void print(const Result& result)
+    {
+        std::cout << "  " << std::left << std::setw(22) << result.benchmark << std::right
+                  << " ops=" << result.operations
+                  << " min=" << result.samples.front().count() << " ns"
+                  << " p50=" << result.percentile(50) << " ns"
+                  << " p90=" << result.percentile(90) << " ns"
+                  << " p99=" << result.percentile(99) << " ns"
+                  << " p50_per_op=" << std::fixed << std::setprecision(outputPrecision) << result.perOperation() << " ns\n";
+    }
+
+    static std::string quoted(std::string_view text)
+    {
+        std::ostringstream out;
+        out << '"';
+        for (const char c : text) {
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+            } else {
+                out << c;
+            }
+        }
+        out << '"';
+        return out.str();
+    }
+
+    const Settings& m_settings;
+    std::vector<Result> m_results;
+};
+
+std::vector<Cmper> partIds(const DocumentPtr& document)
+{
+    std::vector<Cmper> result;
+    for (const auto& part : others::PartDefinition::getInUserOrder(document)) {
+        result.push_back(part->getCmper());
+    }
+    return result;
+}
+
+void runDocumentBenchmarks(Suite& suite, const std::string& fixture, const std::vector<char>& xml)
+{
+    suite.run(fixture, "load", [&]() {
+        if (!musx::factory::DocumentFactory::create<Xml>(xml)) {
+            fail("unable to load " + fixture);
+        }
+        return std::size_t(1);
+    });
+
+    const auto document = musx::factory::DocumentFactory::create<Xml>(xml);
+    const auto parts = partIds(document);
+    const auto frameHolds = document->getDetails()->getArray<details::GFrameHold>(SCORE_PARTID);
+    const auto shapes = document->getOthers()->getArray<others::ShapeDef>(SCORE_PARTID);
+    const auto staves = document->getOthers()->getArray<others::Staff>(SCORE_PARTID);
+    const auto measures = document->getOthers()->getArray<others::Measure>(SCORE_PARTID);
+
+    suite.run(fixture, "iterateEntries", [&]() {
+        std::size_t count = 0;
+        for (const Cmper partId : parts) {
+            document->iterateEntries(partId, [&](const EntryInfoPtr&) {
+                ++count;
+                return true;
+            });
+        }
+        return count;
+    });
+
+    suite.run(fixture, "createEntryFrame", [&]() {
+        std::size_t count = 0;
+        for (const auto& gfHold : frameHolds) {
+            const details::GFrameHoldContext context(gfHold);
+            for (LayerIndex layerIndex = 0; layerIndex < MAX_LAYERS; ++layerIndex) {
+                if (context->frames[layerIndex] && context.createEntryFrame(layerIndex)) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    });
+
+    suite.run(fixture, "beamsAndTies", [&]() {
+        std::size_t count = 0;
+        document->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+            count += entryInfo.calcIsBeamStart() ? 1 : 0;
+            for (std::size_t noteIndex = 0; noteIndex < entryInfo->getEntry()->notes.size(); ++noteIndex) {
+                (void)NoteInfoPtr(entryInfo, noteIndex).calcTieTo();
+            }
+            ++count;
+            return true;
+        });
+        return count;
+    });
+
+    suite.run(fixture, "enigmaString", [&]() {
+        std::size_t count = 0;
+        const auto parse = [&](const auto& texts) {
+            for (const auto& text : texts) {
+                musx::util::EnigmaString::parseEnigmaText(document, SCORE_PARTID, text->text,
+                    [](const std::string&, const musx::util::EnigmaStyles&) { return true; });
+                ++count;
+            }
+        };
+        parse(document->getTexts()->getArray<texts::BlockText>());
+        parse(document->getTexts()->getArray<texts::ExpressionText>());
+        parse(document->getTexts()->getArray<texts::SmartShapeText>());
+        return count;
+    });
+
+    suite.run(fixture, "toSvg", [&]() {
+        for (const auto& shape : shapes) {
+            (void)musx::util::SvgConvert::toSvg(*shape);
+        }
+        return shapes.size();
+    });
+
+    suite.run(fixture, "recognizeShape", [&]() {
+        for (const auto& shape : shapes) {
+            (void)musx::util::recognizeShape(*shape);
+        }
+        return shapes.size();
+    });
+
+    suite.run(fixture, "cueAnalysis", [&]() {
+        std::size_t count = 0;
+        for (const Cmper partId : parts) {
+            for (const auto& gfHold : frameHolds) {
+                const details::GFrameHoldContext context(document, partId, gfHold->getStaff(), gfHold->getMeasure());
+                if (context) {
+                    (void)musx::util::Cue::calcStaffMeasureAnalysis(context);
+                    ++count;
+                }
+            }
+        }
+        return count;
+    });
+
+    suite.run(fixture, "partContextReads", [&]() {
+        std::size_t count = 0;
+        for (const Cmper partId : parts) {
+            for (const auto& staff : staves) {
+                for (const auto& measure : measures) {
+                    if (others::StaffComposite::createCurrent(document, partId, staff->getCmper(), measure->getCmper(), 0)) {
+                        ++count;
+                    }
+                }
+            }
+        }
+        return count;
+    });
+}
+
+/// Measures direct construction of a generated score, then runs the document benchmarks on its EnigmaXML.
+void runSyntheticBenchmarks(Suite& suite, const musxtest::ScoreSpec& spec)
+{
+    const musxtest::ScoreGenerator generator(spec);
+    std::ostringstream name;
+    name << "synthetic-" << spec.staves << "x" << spec.measures << "-p" << spec.parts << "-l" << spec.layers;
+    std::cout << name.str() << ": entries=" << generator.getEntryCount() << " tuplets=" << generator.getTupletCount()
+              << " smartShapes=" << generator.getSmartShapeCount() << '\n';
+
+    suite.run(name.str(), "construct", [&]() {
+        if (!generator.createDocument()) {
+            fail("unable to construct " + name.str());
+        }
+        return generator.getEntryCount();
+    });
+
+    const std::string xml = generator.createEnigmaXml();
+    runDocumentBenchmarks(suite, name.str(), std::vector<char>(xml.begin(), xml.end()));
+}
+
+Settings parseArguments(int argc, char* argv[])
+{
+    Settings settings;
+    const auto synthetic = [&]() -> musxtest::ScoreSpec& {
+        if (!settings.synthetic) {
+            settings.synthetic.emplace();
+            settings.synthetic->optionsSource = std::filesystem::path(MUSX_BENCH_DATA_DIR) / syntheticOptionsFixture;
+        }
+        return *settings.synthetic;
+    };
+    const auto nextValue = [&](int& index) -> std::string {
+        if (index + 1 >= argc) {
+            fail(std::string("missing value for ") + argv[index]);
+        }
+        return argv[++index];
+    };
+    for (int index = 1; index < argc; ++index) {
+        const std::string_view argument = argv[index];
+        if (argument == "--warmup") {
+            settings.warmupSampleCount = std::stoul(nextValue(index));
+        } else if (argument == "--samples") {
+            settings.measuredSampleCount = std::stoul(nextValue(index));
+        } else if (argument == "--filter") {
+            settings.filter = nextValue(index);
+        } else if (argument == "--json") {
+            settings.jsonPath = nextValue(index);
+        } else if (argument == "--synthetic") {
+            synthetic();
+        } else if (argument == "--staves") {
+            synthetic().staves = std::stoul(nextValue(index));
+        } else if (argument == "--measures") {
+            synthetic().measures = std::stoul(nextValue(index));
+        } else if (argument == "--parts") {
+            synthetic().parts = std::stoul(nextValue(index));
+        } else if (argument == "--layers") {
+            synthetic().layers = std::stoul(nextValue(index));
+        } else if (argument == "--tuplet-density") {
+            synthetic().tupletDensity = std::stod(nextValue(index));
+        } else if (argument == "--shape-density") {
+            synthetic().smartShapeDensity = std::stod(nextValue(index));
+        } else if (argument == "--seed") {
+            synthetic().seed = static_cast<std::uint32_t>(std::stoul(nextValue(index)));
+        } else if (argument.substr(0, 2) == "--") {
+            fail("unknown option " + std::string(argument));
+        } else {
+            settings.fixtures.emplace_back(argument);
+        }
+    }
+    if (settings.measuredSampleCount == 0) {
+        fail("--samples must be at least 1");
+    }
+    if (settings.fixtures.empty() && !settings.synthetic) {
+        for (const auto fixture : defaultFixtures) {
+            settings.fixtures.push_back(std::filesystem::path(MUSX_BENCH_DATA_DIR) / fixture);
+        }
+    }
+    return settings;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    try {
+        const Settings settings = parseArguments(argc, argv);
+        musx::util::Logger::setCallback([](musx::util::Logger::LogLevel level, const std::string& message) {
+            if (level == musx::util::Logger::LogLevel::Error) {
+                std::cerr << message << '\n';
+            }
+        });
+
+        Suite suite(settings);
+        std::cout << "warmups=" << settings.warmupSampleCount << " samples=" << settings.measuredSampleCount << '\n';
+        for (const auto& path : settings.fixtures) {
+            std::cout << path.filename().string() << ":\n";
+            runDocumentBenchmarks(suite, path.filename().string(), readFile(path));
+        }
+        if (settings.synthetic) {
+            runSyntheticBenchmarks(suite, *settings.synthetic);
+        }
+
+        if (!settings.jsonPath.empty()) {
+            std::ofstream json(settings.jsonPath);
+            if (!json) {
+                fail("unable to write " + settings.jsonPath.string());
+            }
+            suite.writeJson(json);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "benchmark suite failed: " << error.what() << '\n';
+        return failureExitCode;
+    }
+    return 0;
+}
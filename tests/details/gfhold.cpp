@@ -796,6 +796,8 @@ TEST(GFrameHold, SingletonBeamsTest)
         ASSERT_LT(tupletIndex, entryFrame->tupletInfo.size()) << msg << " tuplet index is too big";
         EXPECT_EQ(isSingletonRight, bool(entryFrame->tupletInfo[tupletIndex].calcCreatesSingletonBeamRight())) << msg << " mismatch on singleton right";
         EXPECT_EQ(isSingletonLeft, bool(entryFrame->tupletInfo[tupletIndex].calcCreatesSingletonBeamLeft())) << msg << " mismatch on singleton left";
+        EXPECT_EQ(isSingletonRight, entryFrame->tupletInfo[tupletIndex].calcCreatesSingletonBeamRight(entryFrame)) << msg << " mismatch on singleton right with frame";
+        EXPECT_EQ(isSingletonLeft, entryFrame->tupletInfo[tupletIndex].calcCreatesSingletonBeamLeft(entryFrame)) << msg << " mismatch on singleton left with frame";
         EXPECT_EQ(isContinuationRight, bool(EntryInfoPtr(entryFrame, entryFrame->tupletInfo[tupletIndex].startIndex).calcBeamContinuesRightOverBarline())) << msg << " mismatch on continuation left";
         EXPECT_EQ(isContinuationLeft, bool(EntryInfoPtr(entryFrame, entryFrame->tupletInfo[tupletIndex].startIndex).calcBeamContinuesLeftOverBarline())) << msg << " mismatch on continuation right";
     };
@@ -81,3 +81,41 @@ TEST(LyricsTest, WordExtensions)
         }
     }
 }
+
+TEST(LyricsTest, LyricIndex)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "wordext.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::tinyxml2::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto& lyricIndex = doc->getLyricIndex(SCORE_PARTID);
+    EXPECT_EQ(&lyricIndex, &doc->getLyricIndex(SCORE_PARTID)) << "index should be built once";
+
+    auto staff = others::StaffComposite::createCurrent(doc, SCORE_PARTID, 1, 1, 0);
+    ASSERT_TRUE(staff);
+    size_t assignmentsChecked = 0;
+    for (const auto& lyricLineInfo : staff->createLyricsLineInfo(1)) {
+        for (const auto& assign : lyricLineInfo.assignments) {
+            ASSERT_GT(assign->syllable, 0u);
+            const auto textNumbers = lyricIndex.getTextNumbers(assign->getLyricTextType());
+            EXPECT_NE(std::find(textNumbers.begin(), textNumbers.end(), assign->lyricNumber), textNumbers.end());
+            EXPECT_GE(lyricIndex.getSyllableCount(assign->getLyricTextType(), assign->lyricNumber), assign->syllable);
+            const auto& indexed = lyricIndex.getAssignments(assign->getLyricTextType(), assign->lyricNumber, assign->syllable - 1);
+            auto it = std::find_if(indexed.begin(), indexed.end(), [&](const LyricIndex::Assignment& a) {
+                return a.entryNumber == assign->getEntryNumber();
+            });
+            ASSERT_NE(it, indexed.end());
+            const auto expected = assign->calcWordExtensionEndpoint();
+            ASSERT_EQ(bool(it->wordExtensionEndpoint), bool(expected));
+            if (expected) {
+                EXPECT_EQ(it->wordExtensionEndpoint.getMeasure(), expected.getMeasure());
+                EXPECT_EQ(it->wordExtensionEndpoint.getIndexInFrame(), expected.getIndexInFrame());
+            }
+            assignmentsChecked++;
+        }
+    }
+    EXPECT_EQ(assignmentsChecked, 6u);
+    EXPECT_TRUE(lyricIndex.getAssignments(LyricTextType::Chorus, 99, 0).empty());
+    EXPECT_EQ(lyricIndex.getSyllableCount(LyricTextType::Section, 99), 0u);
+}
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "musx/musx.h"
 #include "test_utils.h"
@@ -173,3 +175,32 @@ TEST(BeamDetection, TremoloDetectionInTuplet)
     ASSERT_GT(frame->tupletInfo.size(), 2);
     EXPECT_TRUE(frame->tupletInfo.at(1).calcIsTremolo());
 }
+
+TEST(TupletDefTest, SortedTuplets)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "tremolos-adv.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto allTuplets = doc->getDetails()->getArray<details::TupletDef>(SCORE_PARTID);
+    ASSERT_FALSE(allTuplets.empty());
+    for (const auto& tuplet : allTuplets) {
+        const auto entryNumber = tuplet->getEntryNumber();
+        const auto sorted = doc->getSortedTuplets(SCORE_PARTID, entryNumber);
+        ASSERT_NE(sorted, nullptr);
+        const auto unsorted = doc->getDetails()->getArray<details::TupletDef>(SCORE_PARTID, entryNumber);
+        ASSERT_EQ(sorted->size(), unsorted.size()) << "entry " << entryNumber;
+        for (size_t x = 1; x < sorted->size(); x++) {
+            EXPECT_GE((*sorted)[x - 1]->calcReferenceDuration(), (*sorted)[x]->calcReferenceDuration());
+        }
+        for (const auto& item : unsorted) {
+            EXPECT_TRUE(std::any_of(sorted->begin(), sorted->end(), [&](const auto& t) { return t->getInci() == item->getInci(); }));
+        }
+    }
+
+    const auto none = doc->getSortedTuplets(SCORE_PARTID, 999999);
+    ASSERT_NE(none, nullptr);
+    EXPECT_TRUE(none->empty());
+    EXPECT_EQ(doc->getSortedTuplets(9999, allTuplets[0]->getEntryNumber()), nullptr);
+}
@@ -21,6 +21,7 @@
  */
 
 #include <algorithm>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "musx/musx.h"
@@ -309,6 +310,81 @@ TEST(DocumentTest, EmbeddedGraphicsRoundTrip)
     EXPECT_EQ(itJpg->second.bytes, (EmbeddedGraphicBlob{0xFF, 0xD8, 0xFF}));
 }
 
+TEST(DocumentTest, DocumentReference)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "crazy_jumps.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    auto measure = doc->getOthers()->get<others::Measure>(SCORE_PARTID, 3);
+    ASSERT_TRUE(measure);
+    EXPECT_EQ(&measure->getDocumentRef(), doc.get());
+    EXPECT_EQ(measure->getDocument(), doc);
+
+    auto endings = doc->getOthers()->getArray<others::RepeatEndingStart>(SCORE_PARTID);
+    EXPECT_EQ(&endings.getDocumentRef(), doc.get());
+
+    bool foundEntry = false;
+    doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+        EXPECT_EQ(&entryInfo.getFrame()->getDocumentRef(), doc.get());
+        EXPECT_EQ(&entryInfo->getEntry()->getDocumentRef(), doc.get());
+        foundEntry = true;
+        return false;
+    });
+    EXPECT_TRUE(foundEntry);
+}
+
+TEST(DocumentTest, GlobalTimeline)
+{
+    using Fraction = musx::util::Fraction;
+
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "independent_timesig.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto& timeline = doc->getGlobalTimeline(SCORE_PARTID);
+    EXPECT_EQ(&timeline, &doc->getGlobalTimeline(SCORE_PARTID));
+    ASSERT_EQ(timeline.getMeasureCount(), 6);
+    EXPECT_EQ(timeline.getMeasureStart(1), Fraction(0));
+    EXPECT_EQ(timeline.getMeasureStart(3), Fraction(1));
+    EXPECT_EQ(timeline.getMeasureStart(7), Fraction(3));
+    EXPECT_EQ(timeline.getTotalDuration(), Fraction(3));
+    EXPECT_EQ(timeline.getMeasureDuration(2), Fraction(1, 2));
+
+    // staff 2 has an independent time signature of 2 dotted quarters
+    EXPECT_EQ(timeline.getTimeStretch(1, 1), Fraction(1));
+    EXPECT_EQ(timeline.getTimeStretch(1, 2), Fraction(2, 3));
+    EXPECT_EQ(timeline.getStaffDuration(1, 1), Fraction(1, 2));
+    EXPECT_EQ(timeline.getStaffDuration(1, 2), Fraction(3, 4));
+    EXPECT_EQ(timeline.calcAbsolutePosition(3, 2, Fraction(3, 8)), Fraction(5, 4));
+    EXPECT_EQ(timeline.calcAbsolutePosition(MusicPoint(3, Fraction(1, 4))), Fraction(5, 4));
+
+    auto point = timeline.calcMusicPoint(Fraction(5, 4));
+    ASSERT_TRUE(point.has_value());
+    EXPECT_EQ(point->measureId, 3);
+    EXPECT_EQ(point->position, Fraction(1, 4));
+    EXPECT_FALSE(timeline.calcMusicPoint(Fraction(3)).has_value());
+    EXPECT_FALSE(timeline.calcMusicPoint(Fraction(-1, 4)).has_value());
+    EXPECT_THROW(static_cast<void>(timeline.getMeasureDuration(7)), std::out_of_range);
+
+    size_t entryCount = 0;
+    doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+        const auto frame = entryInfo.getFrame();
+        const auto measure = doc->getOthers()->get<others::Measure>(SCORE_PARTID, entryInfo.getMeasure());
+        EXPECT_TRUE(measure);
+        if (!measure) return false;
+        EXPECT_EQ(frame->measureStaffDuration, measure->calcDuration(entryInfo.getStaff()));
+        EXPECT_EQ(frame->getTimeStretch(), measure->calcTimeStretch(entryInfo.getStaff()));
+        EXPECT_EQ(timeline.calcAbsolutePosition(entryInfo),
+            timeline.calcAbsolutePosition(entryInfo.getMeasure(), entryInfo.getStaff(), entryInfo->elapsedDuration));
+        entryCount++;
+        return true;
+    });
+    EXPECT_GT(entryCount, 0u);
+}
+
 namespace {
 
 class CountingOptions final : public musx::dom::OptionsBase
@@ -484,3 +560,358 @@ TEST(DocumentConstructionTest, AbsentNodeFilterCreatesEveryChild)
     EXPECT_EQ(finished->getOthers()->getArray<musx::dom::others::LayerAttributes>(SCORE_PARTID).size(), 4u);
     EXPECT_EQ(finished->getOthers()->getArray<musx::dom::others::FontDefinition>(SCORE_PARTID).size(), 1u);
 }
+
+TEST(DocumentEditTest, RefreshRecomputesOnlyMarkedScopes)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "tie_target_types.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+    EXPECT_FALSE(doc->hasDirtyScopes());
+
+    const auto& entries = doc->getEntries();
+    EXPECT_TRUE(entries->getFrameEntries(1, 2).empty()) << "the frame table is built by the first scoped refresh";
+    entries->buildFrameEntries();
+    const auto meas2Entries = entries->getFrameEntries(1, 2);
+    const auto meas3Entries = entries->getFrameEntries(1, 3);
+    ASSERT_FALSE(meas2Entries.empty());
+    ASSERT_FALSE(meas3Entries.empty());
+    auto clearLocation = [&](EntryNumber entryNumber) {
+        auto entry = entries->get(entryNumber);
+        const auto result = entry->location;
+        const_cast<Entry*>(entry.get())->location.clear();
+        return result;
+    };
+    std::vector<Entry::EntryLocation> meas2Locations;
+    for (const auto entryNumber : meas2Entries) {
+        meas2Locations.push_back(clearLocation(entryNumber));
+    }
+    clearLocation(meas3Entries.front());
+
+    const auto firstEntry = meas2Entries.front();
+    ASSERT_TRUE(doc->getSortedTuplets(SCORE_PARTID, firstEntry));
+    ASSERT_TRUE(doc->getSortedTuplets(SCORE_PARTID, firstEntry)->empty());
+    doc->getDetails()->add(details::TupletDef::XmlNodeName,
+        std::make_shared<details::TupletDef>(doc, SCORE_PARTID, EnigmaBase::ShareMode::All, firstEntry, 0));
+
+    doc->markDirty({ EditScope::Kind::Entries, StaffCmper(1), MeasCmper(2), MeasCmper(2), std::nullopt });
+    EXPECT_TRUE(doc->hasDirtyScopes());
+    musx::factory::DocumentFactory::refresh(doc);
+    EXPECT_FALSE(doc->hasDirtyScopes());
+
+    for (size_t x = 0; x < meas2Entries.size(); x++) {
+        const auto& location = entries->get(meas2Entries[x])->location;
+        EXPECT_EQ(location.staffId, meas2Locations[x].staffId);
+        EXPECT_EQ(location.measureId, meas2Locations[x].measureId);
+        EXPECT_EQ(location.layerIndex, meas2Locations[x].layerIndex);
+        EXPECT_EQ(location.entryIndex, meas2Locations[x].entryIndex);
+    }
+    EXPECT_FALSE(entries->get(meas3Entries.front())->location.found()) << "measure 3 is outside the scope";
+    ASSERT_TRUE(doc->getSortedTuplets(SCORE_PARTID, firstEntry));
+    EXPECT_EQ(doc->getSortedTuplets(SCORE_PARTID, firstEntry)->size(), 1u);
+
+    EditScope allEntries;
+    allEntries.kind = EditScope::Kind::Entries;
+    doc->markDirty(allEntries);
+    musx::factory::DocumentFactory::refresh(doc);
+    EXPECT_TRUE(entries->get(meas3Entries.front())->location.found());
+    EXPECT_EQ(doc->getSortedTuplets(SCORE_PARTID, firstEntry)->size(), 1u);
+}
+
+TEST(DocumentEditTest, RefreshLayoutForPart)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "page_text.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    MusxInstance<others::Page> page;
+    for (const auto& next : doc->getOthers()->getArray<others::Page>(SCORE_PARTID)) {
+        if (!next->isBlank()) {
+            page = next;
+            break;
+        }
+    }
+    ASSERT_TRUE(page);
+    ASSERT_TRUE(page->isLayoutCalculated());
+    const auto lastSystemId = page->lastSystemId;
+    const auto lastMeasureId = page->lastMeasureId;
+    auto* mutablePage = const_cast<others::Page*>(page.get());
+    mutablePage->lastSystemId = std::nullopt;
+    mutablePage->lastMeasureId = std::nullopt;
+    EXPECT_FALSE(page->isLayoutCalculated());
+
+    EditScope scope;
+    scope.kind = EditScope::Kind::Layout;
+    scope.partId = SCORE_PARTID;
+    doc->markDirty(scope);
+    musx::factory::DocumentFactory::refresh(doc);
+    EXPECT_TRUE(page->isLayoutCalculated());
+    EXPECT_EQ(page->lastSystemId, lastSystemId);
+    EXPECT_EQ(page->lastMeasureId, lastMeasureId);
+}
+
+TEST(DocumentEditTest, RefreshStavesResetsMultiStaffInstruments)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "multistaff_inst.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto instGroups = doc->getOthers()->getArray<others::MultiStaffInstrumentGroup>(SCORE_PARTID);
+    ASSERT_FALSE(instGroups.empty());
+    const auto instGroup = instGroups[0];
+    ASSERT_GE(instGroup->staffNums.size(), 2u);
+    const StaffCmper keptStaffId = instGroup->staffNums.front();
+    const StaffCmper droppedStaffId = instGroup->staffNums.back();
+    const auto keptStaff = doc->getOthers()->get<others::Staff>(SCORE_PARTID, keptStaffId);
+    const auto droppedStaff = doc->getOthers()->get<others::Staff>(SCORE_PARTID, droppedStaffId);
+    ASSERT_TRUE(keptStaff);
+    ASSERT_TRUE(droppedStaff);
+    EXPECT_EQ(droppedStaff->multiStaffInstId, instGroup->getCmper());
+
+    EditScope scope;
+    scope.kind = EditScope::Kind::Staves;
+    const_cast<others::MultiStaffInstrumentGroup*>(instGroup.get())->staffNums.pop_back();
+    doc->markDirty(scope);
+    musx::factory::DocumentFactory::refresh(doc);
+    EXPECT_EQ(keptStaff->multiStaffInstId, instGroup->getCmper());
+    EXPECT_EQ(droppedStaff->multiStaffInstId, 0) << "staff " << droppedStaffId << " is no longer in the group";
+
+    for (const auto& next : instGroups) {
+        const_cast<others::MultiStaffInstrumentGroup*>(next.get())->staffNums.clear();
+    }
+    for (const auto& groupId : doc->getOthers()->getArray<others::MultiStaffGroupId>(SCORE_PARTID)) {
+        const_cast<others::MultiStaffGroupId*>(groupId.get())->staffGroupId = 0;
+    }
+    doc->markDirty(scope);
+    musx::factory::DocumentFactory::refresh(doc);
+    for (const auto& staff : doc->getOthers()->getArray<others::Staff>(SCORE_PARTID)) {
+        EXPECT_EQ(staff->multiStaffInstId, 0) << "staff " << staff->getCmper();
+    }
+    for (const auto& group : doc->getDetails()->getArray<details::StaffGroup>(SCORE_PARTID, BASE_SYSTEM_ID)) {
+        EXPECT_EQ(group->multiStaffGroupId, 0) << "group " << group->getCmper2();
+    }
+}
+
+TEST(DocumentEditTest, RefreshExpressionsMovesCategoryMembership)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "expdef.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    MusxInstance<others::TextExpressionDef> expression;
+    for (const auto& next : doc->getOthers()->getArray<others::TextExpressionDef>(SCORE_PARTID)) {
+        if (next->categoryId) {
+            expression = next;
+            break;
+        }
+    }
+    ASSERT_TRUE(expression);
+    const auto oldCategory = doc->getOthers()->get<others::MarkingCategory>(SCORE_PARTID, expression->categoryId);
+    ASSERT_TRUE(oldCategory);
+    MusxInstance<others::MarkingCategory> newCategory;
+    for (const auto& next : doc->getOthers()->getArray<others::MarkingCategory>(SCORE_PARTID)) {
+        if (next->getCmper() != expression->categoryId) {
+            newCategory = next;
+            break;
+        }
+    }
+    ASSERT_TRUE(newCategory);
+    EXPECT_TRUE(oldCategory->textExpressions.count(expression->getCmper()));
+    EXPECT_FALSE(newCategory->textExpressions.count(expression->getCmper()));
+
+    const_cast<others::TextExpressionDef*>(expression.get())->categoryId = newCategory->getCmper();
+    EditScope scope;
+    scope.kind = EditScope::Kind::Expressions;
+    doc->markDirty(scope);
+    musx::factory::DocumentFactory::refresh(doc);
+    EXPECT_FALSE(oldCategory->textExpressions.count(expression->getCmper()));
+    EXPECT_TRUE(newCategory->textExpressions.count(expression->getCmper()));
+}
+
+TEST(DocumentEditTest, RefreshMeasuresRebuildsTimeline)
+{
+    using Fraction = musx::util::Fraction;
+
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "independent_timesig.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+    EXPECT_EQ(doc->getGlobalTimeline(SCORE_PARTID).getMeasureDuration(2), Fraction(1, 2));
+    const size_t shapeCount = doc->getSmartShapeIndex(SCORE_PARTID).getShapeCount();
+
+    auto measure = doc->getOthers()->get<others::Measure>(SCORE_PARTID, 2);
+    ASSERT_TRUE(measure);
+    auto* mutableMeasure = const_cast<others::Measure*>(measure.get());
+    mutableMeasure->beats = 3;
+    mutableMeasure->divBeat = Edu(NoteType::Quarter);
+
+    EditScope scope;
+    scope.kind = EditScope::Kind::Measures;
+    scope.startMeasure = 2;
+    scope.endMeasure = 2;
+    doc->markDirty(scope);
+    musx::factory::DocumentFactory::refresh(doc);
+    const auto& timeline = doc->getGlobalTimeline(SCORE_PARTID);
+    EXPECT_EQ(timeline.getMeasureDuration(2), Fraction(3, 4));
+    EXPECT_EQ(timeline.getTotalDuration(), Fraction(13, 4));
+    EXPECT_EQ(doc->getSmartShapeIndex(SCORE_PARTID).getShapeCount(), shapeCount);
+}
+
+TEST(DocumentCacheTest, SharesDocumentsAndEvictsLeastRecentlyUsed)
+{
+    std::vector<char> jumps;
+    musxtest::readFile(musxtest::getInputPath() / "crazy_jumps.enigmaxml", jumps);
+    std::vector<char> timesig;
+    musxtest::readFile(musxtest::getInputPath() / "independent_timesig.enigmaxml", timesig);
+    auto edited = timesig;
+    edited.push_back('\n');
+
+    using Xml = musx::xml::rapidxml::Document;
+    musx::factory::DocumentCache cache(jumps.size() + edited.size());
+    auto jumpsDoc = cache.get<Xml>(jumps);
+    ASSERT_TRUE(jumpsDoc);
+    EXPECT_EQ(cache.get<Xml>(jumps), jumpsDoc);
+    auto timesigDoc = cache.get<Xml>(timesig);
+    ASSERT_TRUE(timesigDoc);
+    EXPECT_NE(timesigDoc, jumpsDoc);
+
+    auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.entryCount, 2u);
+    EXPECT_EQ(stats.totalBytes, jumps.size() + timesig.size());
+
+    // touch jumps so that timesig is least recently used, then exceed the budget
+    EXPECT_EQ(cache.get<Xml>(jumps), jumpsDoc);
+    auto editedDoc = cache.get<Xml>(edited);
+    ASSERT_TRUE(editedDoc);
+    stats = cache.getStatistics();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entryCount, 2u);
+    EXPECT_EQ(stats.totalBytes, jumps.size() + edited.size());
+    EXPECT_EQ(cache.get<Xml>(jumps), jumpsDoc);
+    EXPECT_NE(cache.get<Xml>(timesig), timesigDoc) << "evicted content is loaded again";
+
+    // failed loads are not cached
+    const musxtest::string_view notEnigma = R"xml(<?xml version="1.0" encoding="UTF-8"?><notfinale/>)xml";
+    const size_t missesBefore = cache.getStatistics().misses;
+    EXPECT_THROW((void)cache.get<Xml>(std::vector<char>(notEnigma)), std::invalid_argument);
+    EXPECT_THROW((void)cache.get<Xml>(std::vector<char>(notEnigma)), std::invalid_argument);
+    EXPECT_EQ(cache.getStatistics().misses, missesBefore + 2);
+
+    cache.clear();
+    stats = cache.getStatistics();
+    EXPECT_EQ(stats.entryCount, 0u);
+    EXPECT_EQ(stats.totalBytes, 0u);
+    EXPECT_EQ(stats.hits, 0u);
+}
+
+TEST(DocumentCacheTest, SkipsEntriesThatAreStillLoading)
+{
+    musx::factory::DocumentCache cache(15);
+    auto loading = cache.getOrCreate("loading", 10, [&]() {
+        auto other = cache.getOrCreate("other", 10, []() { return DocumentPtr(); });
+        EXPECT_FALSE(other);
+        const auto stats = cache.getStatistics();
+        EXPECT_EQ(stats.evictions, 0u) << "the entry being loaded is not evicted";
+        EXPECT_EQ(stats.entryCount, 2u);
+        return DocumentPtr();
+    });
+    EXPECT_FALSE(loading);
+    const auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.evictions, 1u) << "the finished entry is least recently used";
+    EXPECT_EQ(stats.entryCount, 1u);
+    EXPECT_EQ(stats.totalBytes, 10u);
+}
+
+TEST(DocumentCacheTest, ConcurrentRequestsShareOneReadOnlyDocument)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "crazy_jumps.enigmaxml", xml);
+    musx::factory::DocumentCache cache(xml.size());
+
+    constexpr size_t threadCount = 8;
+    std::vector<DocumentPtr> documents(threadCount);
+    std::vector<size_t> noteCounts(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t x = 0; x < threadCount; x++) {
+        threads.emplace_back([&, x]() {
+            auto doc = cache.get<musx::xml::rapidxml::Document>(xml);
+            (void)doc->getGlobalTimeline(SCORE_PARTID);
+            (void)doc->getTieGraph(SCORE_PARTID);
+            doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+                for (size_t noteIndex = 0; noteIndex < entryInfo->getEntry()->notes.size(); noteIndex++) {
+                    (void)NoteInfoPtr(entryInfo, noteIndex).calcNoteProperties();
+                    noteCounts[x]++;
+                }
+                return true;
+            });
+            documents[x] = std::move(doc);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, threadCount - 1);
+    EXPECT_GT(noteCounts[0], 0u);
+    for (size_t x = 1; x < threadCount; x++) {
+        EXPECT_EQ(documents[x], documents[0]);
+        EXPECT_EQ(noteCounts[x], noteCounts[0]);
+    }
+}
+
+TEST(LoadProfileTest, RecordsPhasesAndNodeCounts)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "crazy_jumps.enigmaxml", xml);
+
+    auto profile = std::make_shared<musx::factory::LoadProfile>();
+    size_t allocationCount = 0;
+    profile->allocationCounter = [&allocationCount]() { return allocationCount += 3; };
+    musx::factory::DocumentFactory::CreateOptions createOptions;
+    createOptions.profile = profile;
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(xml, std::move(createOptions));
+    ASSERT_TRUE(doc);
+
+    for (const auto name : { "parse", "pool:header", "pool:others", "pool:entries", "integrity:others", "sortedTuplets",
+                             "resolver:measSpec", "resolver:fontName", "instruments", "partMembership",
+                             "rehearsalMarks", "blankPages" }) {
+        auto phase = profile->findPhase(name);
+        ASSERT_TRUE(phase) << name;
+        ASSERT_TRUE(phase->allocations) << name;
+        EXPECT_EQ(*phase->allocations, 3u) << name;
+    }
+    EXPECT_EQ(profile->phases.front().name, "parse");
+    EXPECT_EQ(profile->phases.back().name, "blankPages");
+    EXPECT_GT(profile->calcTotalDuration().count(), 0);
+
+    auto measures = doc->getOthers()->getArray<others::Measure>(SCORE_PARTID);
+    ASSERT_TRUE(profile->nodeCounts.count("measSpec"));
+    EXPECT_GE(profile->nodeCounts.at("measSpec"), measures.size());
+    ASSERT_TRUE(profile->nodeCounts.count("entry"));
+    EXPECT_GT(profile->nodeCounts.at("entry"), 0u);
+    EXPECT_FALSE(profile->nodeCounts.count("noSuchNode"));
+}
+
+TEST(LoadProfileTest, RecordsFinalizePhasesForSessions)
+{
+    auto session = musx::factory::DocumentFactory::begin();
+    EXPECT_FALSE(session.getConstructionContext().getLoadProfile());
+
+    musx::factory::DocumentFactory::ConstructionOptions options;
+    options.profile = std::make_shared<musx::factory::LoadProfile>();
+    auto profiledSession = musx::factory::DocumentFactory::begin(options);
+    EXPECT_EQ(profiledSession.getConstructionContext().getLoadProfile(), options.profile.get());
+    auto doc = std::move(profiledSession).finish();
+    ASSERT_TRUE(doc);
+    EXPECT_FALSE(options.profile->findPhase("parse"));
+    EXPECT_TRUE(options.profile->findPhase("integrity:entries"));
+    EXPECT_TRUE(options.profile->findPhase("blankPages"));
+    EXPECT_TRUE(options.profile->nodeCounts.empty());
+}
@@ -57,6 +57,18 @@ TEST(InstrumentTest, InstrumentFamilySpecialAndUnknownUuids)
     EXPECT_EQ(instrumentFamilyFromUuid("not-a-finale-instrument-uuid"), InstrumentFamily::Unspecified);
 }
 
+TEST(InstrumentTest, InstrumentIdLookups)
+{
+    static_assert(calcInstrumentId(uuid::Violin) != calcInstrumentId(uuid::Viola));
+    EXPECT_EQ(calcInstrumentId(std::string(uuid::Violin)), calcInstrumentId(uuid::Violin));
+    EXPECT_EQ(instrumentFamilyFromId(calcInstrumentId(uuid::Violin)), InstrumentFamily::Strings);
+    EXPECT_EQ(instrumentFamilyFromId(calcInstrumentId(uuid::Zills)), InstrumentFamily::Percussion);
+    EXPECT_EQ(instrumentFamilyFromId(calcInstrumentId(uuid::BlankStaff)), InstrumentFamily::Unspecified);
+    EXPECT_EQ(instrumentFamilyFromId(calcInstrumentId("not-a-finale-instrument-uuid")), InstrumentFamily::Unspecified);
+    EXPECT_EQ(instrumentSoloOrEnsembleFromId(calcInstrumentId(uuid::ViolinSection)), SoloOrEnsemble::Ensemble);
+    EXPECT_EQ(instrumentSoloOrEnsembleFromId(calcInstrumentId(uuid::MusicXmlAlbogue)), SoloOrEnsemble::Solo);
+}
+
 TEST(InstrumentTest, InstrumentSoloOrEnsembleFromUuid)
 {
     EXPECT_EQ(instrumentSoloOrEnsembleFromUuid(uuid::Violin), SoloOrEnsemble::Solo);
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "gtest/gtest.h"
+#include "musx/musx.h"
+#include "test_utils.h"
+#include "score_generator.h"
+
+using namespace musx::dom;
+
+namespace {
+
+size_t countScoreEntries(const DocumentPtr& doc, Cmper partId)
+{
+    size_t result = 0;
+    doc->iterateEntries(partId, [&](const EntryInfoPtr&) {
+        result++;
+        return true;
+    });
+    return result;
+}
+
+} // namespace
+
+TEST(ScoreGeneratorTest, DocumentMatchesItsEnigmaXml)
+{
+    musxtest::ScoreSpec spec;
+    spec.staves = 6;
+    spec.measures = 12;
+    spec.parts = 3;
+    spec.layers = 2;
+    spec.tupletDensity = 0.5;
+    spec.smartShapeDensity = 0.5;
+    spec.seed = 7;
+    spec.optionsSource = musxtest::getInputPath() / "ties.enigmaxml";
+    musxtest::ScoreGenerator generator(spec);
+    ASSERT_GT(generator.getTupletCount(), 0u);
+    ASSERT_GT(generator.getSmartShapeCount(), 0u);
+
+    auto inMemory = generator.createDocument();
+    auto fromXml = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(generator.createEnigmaXml());
+    for (const auto& doc : { inMemory, fromXml }) {
+        ASSERT_TRUE(doc);
+        ASSERT_TRUE(doc->getOptions()->get<options::TieOptions>());
+        EXPECT_EQ(doc->getOthers()->getArray<others::Measure>(SCORE_PARTID).size(), spec.measures);
+        EXPECT_EQ(doc->getOthers()->getArray<others::PartDefinition>(SCORE_PARTID).size(), spec.parts + 1);
+        EXPECT_EQ(doc->getDetails()->getArray<details::TupletDef>(SCORE_PARTID).size(), generator.getTupletCount());
+        EXPECT_EQ(doc->getOthers()->getArray<others::SmartShape>(SCORE_PARTID).size(), generator.getSmartShapeCount());
+        EXPECT_EQ(countScoreEntries(doc, SCORE_PARTID), generator.getEntryCount());
+
+        size_t partStaves = 0;
+        size_t partEntries = 0;
+        for (Cmper partId = 1; partId <= spec.parts; partId++) {
+            partStaves += doc->getScrollViewStaves(partId).size();
+            partEntries += countScoreEntries(doc, partId);
+            EXPECT_EQ(countScoreEntries(doc, partId), countScoreEntries(inMemory, partId)) << "part " << partId;
+        }
+        EXPECT_EQ(partStaves, spec.staves);
+        EXPECT_EQ(partEntries, generator.getEntryCount());
+
+        // every layer fills its measure, with or without triplets
+        size_t tupletCount = 0;
+        for (StaffCmper staffId = 1; staffId <= StaffCmper(spec.staves); staffId++) {
+            for (MeasCmper measureId = 1; measureId <= MeasCmper(spec.measures); measureId++) {
+                details::GFrameHoldContext gfHold(doc, SCORE_PARTID, staffId, measureId);
+                ASSERT_TRUE(gfHold);
+                for (LayerIndex layerIndex = 0; layerIndex < spec.layers; layerIndex++) {
+                    auto entryFrame = gfHold.createEntryFrame(layerIndex);
+                    ASSERT_TRUE(entryFrame);
+                    tupletCount += entryFrame->tupletInfo.size();
+                    const auto& lastEntry = entryFrame->getEntries().back();
+                    EXPECT_EQ(lastEntry->elapsedDuration + lastEntry->actualDuration, musx::util::Fraction(1))
+                        << "staff " << staffId << " measure " << measureId << " layer " << layerIndex;
+                }
+            }
+        }
+        EXPECT_EQ(tupletCount, generator.getTupletCount());
+    }
+}
+
+TEST(ScoreGeneratorTest, SameSpecGivesSameScore)
+{
+    musxtest::ScoreSpec spec;
+    spec.tupletDensity = 0.25;
+    spec.smartShapeDensity = 0.25;
+    const auto xml = musxtest::ScoreGenerator(spec).createEnigmaXml();
+    EXPECT_EQ(musxtest::ScoreGenerator(spec).createEnigmaXml(), xml);
+    spec.seed++;
+    EXPECT_NE(musxtest::ScoreGenerator(spec).createEnigmaXml(), xml);
+}
+
+TEST(ScoreGeneratorTest, RejectsSpecsOutOfRange)
+{
+    const auto makeSpec = [](auto&& modify) {
+        musxtest::ScoreSpec spec;
+        modify(spec);
+        return spec;
+    };
+    EXPECT_THROW(musxtest::ScoreGenerator(makeSpec([](auto& spec) { spec.staves = 0; })), std::invalid_argument);
+    EXPECT_THROW(musxtest::ScoreGenerator(makeSpec([](auto& spec) { spec.layers = MAX_LAYERS + 1; })), std::invalid_argument);
+    EXPECT_THROW(musxtest::ScoreGenerator(makeSpec([](auto& spec) { spec.tupletDensity = 1.5; })), std::invalid_argument);
+    EXPECT_THROW(musxtest::ScoreGenerator(makeSpec([](auto& spec) { spec.staves = 100; spec.measures = 1000; })), std::invalid_argument)
+        << "more frames than a frame cmper can address";
+}
@@ -25,6 +25,8 @@
 #include "test_utils.h"
 
 #include <array>
+#include <set>
+#include <tuple>
 
 using namespace musx::dom;
 
@@ -166,6 +168,23 @@ TEST(EntryTest, PopulateFields)
     }
 }
 
+#ifndef MUSX_COMPACT_ENTRIES
+TEST(EntryTest, FlagsAreAddressable)
+{
+    Entry entry(DocumentWeakPtr{}, 0, Entry::ShareMode::All, 1, 0, 0);
+    Note note(DocumentWeakPtr{}, 1);
+
+    bool Entry::* entryFlag = &Entry::isNote;
+    bool& noteFlag = note.tieStart;
+    entry.*entryFlag = true;
+    noteFlag = true;
+    EXPECT_TRUE(entry.isNote);
+    EXPECT_FALSE(entry.graceNote);
+    EXPECT_TRUE(note.tieStart);
+    EXPECT_FALSE(note.tieEnd);
+}
+#endif
+
 TEST(EntryTest, IntegrityCheck)
 {
     constexpr static musxtest::string_view xmlWrongNumNotes = R"xml(
@@ -777,3 +796,119 @@ TEST(NoteheadInfoTest, PercussionNoteOverride)
     auto secondNoteheadInfo = secondNote.calcNoteheadInfo();
     EXPECT_EQ(secondNoteheadInfo.character, char32_t(57534));
 }
+
+TEST(EntryTest, ArenaTraversalMatchesEntryList)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "enharmonics_test.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    auto entries = doc->getEntries();
+    size_t framesChecked = 0;
+    for (const auto& frame : doc->getOthers()->getArray<others::Frame>(SCORE_PARTID)) {
+        if (!frame->startEntry) {
+            continue;
+        }
+        std::vector<EntryNumber> expected;
+        for (auto entry = entries->get(frame->startEntry); entry; entry = entry->getNext()) {
+            expected.push_back(entry->getEntryNumber());
+            if (entry->getEntryNumber() == frame->endEntry) {
+                break;
+            }
+        }
+        std::vector<EntryNumber> actual;
+        for (const auto& entry : frame->getEntries()) {
+            actual.push_back(entry->getEntryNumber());
+        }
+        EXPECT_EQ(actual, expected) << "frame " << frame->getCmper() << " inci " << frame->getInci().value_or(-1);
+
+        // stopping early reports false
+        if (!expected.empty()) {
+            size_t visited = 0;
+            EXPECT_FALSE(entries->iterateEntries(entries->get(frame->startEntry), frame->endEntry, [&](const MusxInstance<Entry>&) {
+                visited++;
+                return false;
+            }));
+            EXPECT_EQ(visited, 1u);
+        }
+        framesChecked++;
+    }
+    EXPECT_GT(framesChecked, 0u);
+
+    // rebuilding the arena leaves traversal unchanged
+    auto frame = doc->getOthers()->getArray<others::Frame>(SCORE_PARTID);
+    ASSERT_FALSE(frame.empty());
+    const auto before = frame[0]->getEntries();
+    entries->buildArena();
+    const auto after = frame[0]->getEntries();
+    ASSERT_EQ(before.size(), after.size());
+    for (size_t x = 0; x < before.size(); x++) {
+        EXPECT_EQ(before[x].get(), after[x].get());
+    }
+}
+
+TEST(EntryTest, ArenaTraversalFollowsListWhenEveryLinkDiverges)
+{
+    auto session = musx::factory::DocumentFactory::begin();
+    const auto& doc = session.getDocument();
+    auto entries = doc->getEntries();
+
+    // locations in reverse list order lay the arena out backwards, so no list link matches the arena
+    constexpr EntryNumber entryCount = 200000;
+    for (EntryNumber entryNumber = 1; entryNumber <= entryCount; entryNumber++) {
+        auto entry = std::make_shared<Entry>(doc, SCORE_PARTID, Entry::ShareMode::All, entryNumber,
+            entryNumber - 1, entryNumber < entryCount ? entryNumber + 1 : 0);
+        entry->location.staffId = 1;
+        entry->location.measureId = 1;
+        entry->location.entryIndex = size_t(entryCount - entryNumber);
+        entries->add(entryNumber, entry);
+    }
+    entries->buildArena();
+
+    EntryNumber expected = 1;
+    EXPECT_TRUE(entries->iterateEntries(entries->get(1), entryCount, [&](const MusxInstance<Entry>& entry) {
+        EXPECT_EQ(entry->getEntryNumber(), expected);
+        expected++;
+        return true;
+    }));
+    EXPECT_EQ(expected, entryCount + 1);
+}
+
+TEST(EntryTest, EntryInfoResolver)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "enharmonics_test.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    std::vector<EntryInfoPtr> expected;
+    doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+        expected.push_back(entryInfo);
+        return true;
+    });
+    ASSERT_GE(expected.size(), 2u);
+
+    EntryInfoResolver resolver(doc, SCORE_PARTID);
+    std::set<std::tuple<StaffCmper, MeasCmper, LayerIndex>> locations;
+    for (const auto& entryInfo : expected) {
+        const auto entryNumber = entryInfo->getEntry()->getEntryNumber();
+        const auto resolved = resolver.resolve(entryNumber);
+        ASSERT_TRUE(resolved) << "entry " << entryNumber;
+        EXPECT_TRUE(resolved.isSameEntry(entryInfo));
+        EXPECT_EQ(resolved.getIndexInFrame(), entryInfo.getIndexInFrame());
+        EXPECT_EQ(resolved->elapsedDuration, entryInfo->elapsedDuration);
+        EXPECT_TRUE(resolved.isSameEntry(EntryInfoPtr::fromEntryNumber(doc, SCORE_PARTID, entryNumber)));
+        locations.emplace(resolved.getStaff(), resolved.getMeasure(), resolved.getLayerIndex());
+    }
+    // each layer of each measure is built once
+    EXPECT_EQ(resolver.getFrameCount(), locations.size());
+
+    const auto first = resolver.resolve(expected[0]->getEntry()->getEntryNumber());
+    const auto again = resolver.resolve(expected[0]->getEntry()->getEntryNumber());
+    EXPECT_EQ(first.getFrame(), again.getFrame());
+
+    EXPECT_FALSE(resolver.resolve(0));
+    resolver.clear();
+    EXPECT_EQ(resolver.getFrameCount(), 0u);
+}
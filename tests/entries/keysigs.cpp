@@ -162,6 +162,56 @@ TEST(KeySigs, Test31EDO)
     }
 }
 
+TEST(KeySigs, TransposerAndSpellingMemo)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "keysigs.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    auto measures = doc->getOthers()->getArray<others::Measure>(SCORE_PARTID);
+    ASSERT_GE(measures.size(), 7u);
+
+    for (const auto& measure : measures) {
+        auto key = measure->createKeySignature();
+        for (int disp = -10; disp <= 10; disp++) {
+            for (int alt = -2; alt <= 2; alt++) {
+                // value transposer matches the legacy vector-based construction
+                music_theory::Transposer legacy(disp, alt, key->isMinor(), key->calcEDODivisions(), key->calcKeyMap());
+                auto stack = key->calcTransposer(disp, alt);
+                legacy.chromaticTranspose(2, -1);
+                stack.chromaticTranspose(2, -1);
+                EXPECT_EQ(legacy.displacement(), stack.displacement());
+                EXPECT_EQ(legacy.alteration(), stack.alteration());
+
+                // memoized spelling is stable and matches the direct calculation
+                const auto first = key->calcNoteSpelling(disp, alt, KeySignature::KeyContext::Written, true, 2, -1);
+                const auto second = key->calcNoteSpelling(disp, alt, KeySignature::KeyContext::Written, true, 2, -1);
+                auto [respelledDisp, respelledAlt] = key->calcDefaultEnharmonic(disp, alt);
+                auto transposer = key->calcTransposer(respelledDisp, respelledAlt);
+                transposer.chromaticTranspose(2, -1);
+                const auto pitch = key->calcPitch(transposer.displacement(), transposer.alteration(), KeySignature::KeyContext::Written);
+                EXPECT_EQ(first.displacement, transposer.displacement());
+                EXPECT_EQ(first.alteration, transposer.alteration());
+                EXPECT_EQ(first.pitch.noteName, pitch.noteName);
+                EXPECT_EQ(first.pitch.octave, pitch.octave);
+                EXPECT_EQ(first.pitch.alteration, pitch.alteration);
+                EXPECT_EQ(second.displacement, first.displacement);
+                EXPECT_EQ(second.alteration, first.alteration);
+                EXPECT_EQ(second.middleCOffset, first.middleCOffset);
+            }
+        }
+    }
+
+    // changing the transposition invalidates the memo
+    auto key = std::make_shared<KeySignature>(*measures[0]->createKeySignature());
+    const auto untransposed = key->calcNoteSpelling(0, 0, KeySignature::KeyContext::Written);
+    key->setTransposition(1, 2, true); // Bb transposition: written a major second higher
+    const auto transposed = key->calcNoteSpelling(0, 0, KeySignature::KeyContext::Written);
+    EXPECT_EQ(transposed.middleCOffset, untransposed.middleCOffset + 1);
+    EXPECT_NE(transposed.pitch.noteName, untransposed.pitch.noteName);
+}
+
 TEST(KeySigs, PopulateKeyAttributes)
 {
     std::vector<char> xml;
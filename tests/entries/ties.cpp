@@ -1149,3 +1149,93 @@ TEST(TieDetection, TieConnectionTypeForTiesToNowhere)
         checkTieConnectionType(NoteInfoPtr(EntryInfoPtr(entryFrame, 0), 3), CT::EntryRightNoteCenter, CT::EntryLeftNoteCenter, CT::EntryRightNoteCenter, CT::EntryLeftNoteCenter);
     }
 }
+
+TEST(TieGraph, MatchesPerNoteQueries)
+{
+    for (const auto* fileName : { "ties.enigmaxml", "tie_target_types.enigmaxml", "tie_across_gap.enigmaxml",
+                                  "lvshapes.enigmaxml", "crazy_jumps.enigmaxml" }) {
+        std::vector<char> xml;
+        musxtest::readFile(musxtest::getInputPath() / fileName, xml);
+        auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+        ASSERT_TRUE(doc) << fileName;
+
+        const auto& tieGraph = doc->getTieGraph(SCORE_PARTID);
+        EntryInfoResolver resolver(doc, SCORE_PARTID);
+        size_t jumpTieCount = 0;
+        doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+            const auto entry = entryInfo->getEntry();
+            if (!entry->isNote) {
+                return true;
+            }
+            for (size_t noteIndex = 0; noteIndex < entry->notes.size(); noteIndex++) {
+                NoteInfoPtr noteInfo(entryInfo, noteIndex);
+                const std::string msg = std::string(fileName) + " entry " + std::to_string(entry->getEntryNumber())
+                    + " note " + std::to_string(noteIndex);
+                const auto* tieTo = tieGraph.getTieTo(noteInfo);
+                if (noteInfo->tieStart) {
+                    if (auto tiedTo = noteInfo.calcTieTo()) {
+                        EXPECT_TRUE(tieTo) << msg;
+                        if (tieTo) {
+                            EXPECT_EQ(tieTo->type, TieGraph::LinkType::Tie) << msg;
+                            EXPECT_EQ(tieTo->to, TieGraph::NoteKey::fromNoteInfo(tiedTo)) << msg;
+                            EXPECT_EQ(tieTo->from, TieGraph::NoteKey::fromNoteInfo(noteInfo)) << msg;
+                            EXPECT_TRUE(tieTo->to.calcNoteInfo(resolver).isSameNote(tiedTo)) << msg;
+                        }
+                    }
+                }
+                if (tieTo && tieTo->type == TieGraph::LinkType::ArpeggiatedTie) {
+                    const auto arpeggiatedTie = noteInfo.calcArpeggiatedTieInfo();
+                    EXPECT_TRUE(arpeggiatedTie) << msg;
+                    if (arpeggiatedTie) {
+                        EXPECT_EQ(tieTo->to, TieGraph::NoteKey::fromNoteInfo(NoteInfoPtr(arpeggiatedTie->targetEntry, arpeggiatedTie->targetNoteIndex))) << msg;
+                    }
+                }
+                if (auto tiedFrom = noteInfo.calcTieFrom()) {
+                    const auto* tieFrom = tieGraph.getTieFrom(noteInfo);
+                    EXPECT_TRUE(tieFrom) << msg;
+                    if (tieFrom) {
+                        EXPECT_EQ(tieFrom->from, TieGraph::NoteKey::fromNoteInfo(tiedFrom)) << msg;
+                        EXPECT_TRUE(tieFrom->from.calcNoteInfo(resolver).isSameNote(tiedFrom)) << msg;
+                        EXPECT_EQ(tieGraph.getTieFrom(entry->getEntryNumber(), noteInfo->getNoteId()), tieFrom) << msg;
+                    }
+                }
+                const auto jumpTies = noteInfo.calcJumpTieContinuationsFrom();
+                const auto& jumpLinks = tieGraph.getJumpTiesFrom(entry->getEntryNumber(), noteInfo->getNoteId());
+                EXPECT_EQ(jumpLinks.size(), jumpTies.size()) << msg;
+                for (size_t x = 0; x < std::min(jumpTies.size(), jumpLinks.size()); x++) {
+                    EXPECT_EQ(jumpLinks[x].from, TieGraph::NoteKey::fromNoteInfo(jumpTies[x].first)) << msg;
+                    EXPECT_EQ(jumpLinks[x].type, TieGraph::LinkType::JumpTie) << msg;
+                }
+                jumpTieCount += jumpTies.size();
+            }
+            return true;
+        });
+        EXPECT_GE(tieGraph.getLinkCount(), jumpTieCount) << fileName;
+    }
+}
+
+TEST(TieGraph, JumpAndPseudoTies)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "tie_target_types.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    auto gfhold = details::GFrameHoldContext(doc, SCORE_PARTID, 1, 4);
+    ASSERT_TRUE(gfhold);
+    auto entryFrame = gfhold.createEntryFrame(0);
+    ASSERT_TRUE(entryFrame);
+    EntryInfoPtr chordEntry(entryFrame, 0);
+    ASSERT_TRUE(chordEntry);
+    ASSERT_GE(chordEntry->getEntry()->notes.size(), 3u);
+
+    const auto& tieGraph = doc->getTieGraph(SCORE_PARTID);
+    for (size_t noteIndex = 0; noteIndex < chordEntry->getEntry()->notes.size(); noteIndex++) {
+        NoteInfoPtr noteInfo(chordEntry, noteIndex);
+        const auto& jumpLinks = tieGraph.getJumpTiesFrom(chordEntry->getEntry()->getEntryNumber(), noteInfo->getNoteId());
+        ASSERT_EQ(jumpLinks.size(), 1u) << "note " << noteIndex;
+        EXPECT_EQ(jumpLinks[0].from.measureId, 2);
+        EXPECT_EQ(jumpLinks[0].to, TieGraph::NoteKey::fromNoteInfo(noteInfo));
+    }
+    EXPECT_EQ(&doc->getTieGraph(SCORE_PARTID), &tieGraph);
+}
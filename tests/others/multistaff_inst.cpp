@@ -298,6 +298,54 @@ TEST(MultiStaffGroupTest, InstrumentDetectionPart)
     EXPECT_EQ(instInfo.staves.at(4), 1);
 }
 
+TEST(MultiStaffGroupTest, StaffIndexAndPartMembership)
+{
+    std::vector<char> enigmaXml;
+    musxtest::readFile(musxtest::getInputPath() / "multistaff_inst_groups_EDITED.enigmaxml", enigmaXml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::tinyxml2::Document>(enigmaXml);
+    ASSERT_TRUE(doc);
+
+    auto instruments = doc->getInstruments();
+    for (const auto& [topStaff, info] : instruments) {
+        for (const auto& [staffId, index] : info.staves) {
+            const auto* instrument = instruments.getInstrumentForStaff(staffId);
+            ASSERT_TRUE(instrument) << "staff " << staffId;
+            EXPECT_EQ(instrument->staves.size(), info.staves.size()) << "staff " << staffId;
+            EXPECT_EQ(instrument->staves.count(topStaff), 1u) << "staff " << staffId;
+        }
+    }
+    ASSERT_TRUE(instruments.getInstrumentForStaff(4));
+    instruments.erase(3);
+    EXPECT_FALSE(instruments.getInstrumentForStaff(4)) << "stale index entries should not be returned";
+    instruments.calcStaffIndex();
+    EXPECT_FALSE(instruments.getInstrumentForStaff(4));
+
+    const auto parts = doc->getOthers()->getArray<others::PartDefinition>(SCORE_PARTID);
+    const auto staves = doc->getOthers()->getArray<others::Staff>(SCORE_PARTID);
+    ASSERT_FALSE(staves.empty());
+    for (const auto& staff : staves) {
+        size_t expectedPartCount = 0;
+        for (const auto& part : parts) {
+            const auto scrollView = doc->getScrollViewStaves(part->getCmper());
+            const bool expected = scrollView.getIndexForStaff(staff->getCmper()).has_value();
+            EXPECT_EQ(doc->isStaffInPart(staff->getCmper(), part->getCmper()), expected)
+                << "staff " << staff->getCmper() << " part " << part->getCmper();
+            if (expected && part->getCmper() != SCORE_PARTID) {
+                expectedPartCount++;
+            }
+        }
+        EXPECT_EQ(staff->getContainingParts(/*includeScore*/ false).size(), expectedPartCount) << "staff " << staff->getCmper();
+        const auto withScore = staff->getContainingParts(/*includeScore*/ true);
+        const bool inScore = doc->isStaffInPart(staff->getCmper(), SCORE_PARTID);
+        ASSERT_EQ(withScore.size(), expectedPartCount + (inScore ? 1 : 0)) << "staff " << staff->getCmper();
+        if (inScore) {
+            EXPECT_EQ(withScore[0]->getCmper(), SCORE_PARTID) << "parts should be in pool order";
+        }
+    }
+    EXPECT_TRUE(doc->isStaffInPart(4, 3));
+    EXPECT_FALSE(doc->isStaffInPart(4, 9999));
+}
+
 TEST(MultiStaffGroupTest, PartScoreInstrumentNames)
 {
     std::vector<char> xml;
@@ -193,3 +193,18 @@ TEST(StaffTest, CalcPercussionNoteInfo)
         checkNoteInfo(NoteInfoPtr(EntryInfoPtr(entryFrame, 2), 0), false, 0, 0);
     }
 }
+
+TEST(PercussionNoteTypeTest, LookupById)
+{
+    const auto& cowbell = percussion::getPercussionNoteTypeFromId(6);
+    EXPECT_EQ(cowbell.instrumentId, 6);
+    EXPECT_STREQ(cowbell.rawName, "Cowbell");
+    EXPECT_EQ(cowbell.generalMidi, 56);
+
+    const auto& custom = percussion::getPercussionNoteTypeFromId(4095);
+    EXPECT_EQ(custom.instrumentId, 4095);
+    EXPECT_EQ(custom.createName(0), "Custom 128");
+
+    EXPECT_STREQ(percussion::getPercussionNoteTypeFromId(0).rawName, "Unknown");
+    EXPECT_STREQ(percussion::getPercussionNoteTypeFromId(0xffff).rawName, "Unknown");
+}
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+ #include <algorithm>
+
  #include "gtest/gtest.h"
  #include "musx/musx.h"
  #include "test_utils.h"
@@ -812,3 +814,52 @@ TEST(SmartShapes, VerticalPlacementForBeatAttached)
     // Entry-based shapes have no beat-attached placement.
     EXPECT_EQ(placementFor(5), VerticalPlacement::NotApplicable);
 }
+
+TEST(SmartShapes, SmartShapeIndex)
+{
+    std::vector<char> enigmaXml;
+    musxtest::readFile(musxtest::getInputPath() / "independent_timesig.enigmaxml", enigmaXml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(enigmaXml);
+    ASSERT_TRUE(doc);
+
+    const auto& index = doc->getSmartShapeIndex(SCORE_PARTID);
+    EXPECT_EQ(&doc->getSmartShapeIndex(SCORE_PARTID), &index);
+    EXPECT_EQ(index.getShapeCount(), 2u);
+
+    // entry-attached slur, which shares its entries with the hairpin below
+    const auto* slur = index.getEndpoints(1);
+    ASSERT_TRUE(slur);
+    EXPECT_EQ(slur->startEntry, 49);
+    EXPECT_EQ(slur->endEntry, 52);
+    EXPECT_EQ(slur->startStaff, 2);
+    EXPECT_EQ(slur->startMeasure, 3);
+    EXPECT_EQ(index.getStartingShapes(49), (std::vector<Cmper>{ 1, 4 }));
+    EXPECT_EQ(index.getEndingShapes(52), (std::vector<Cmper>{ 1, 4 }));
+
+    // beat-attached hairpin resolves to the same entries as calcAssociatedEntry
+    auto cresc = doc->getOthers()->get<others::SmartShape>(SCORE_PARTID, 4);
+    ASSERT_TRUE(cresc);
+    const auto* crescEndpoints = index.getEndpoints(4);
+    ASSERT_TRUE(crescEndpoints);
+    auto startEntry = cresc->startTermSeg->endPoint->calcAssociatedEntry();
+    auto endEntry = cresc->endTermSeg->endPoint->calcAssociatedEntry();
+    ASSERT_TRUE(startEntry);
+    ASSERT_TRUE(endEntry);
+    EXPECT_EQ(crescEndpoints->startEntry, startEntry->getEntry()->getEntryNumber());
+    EXPECT_EQ(crescEndpoints->endEntry, endEntry->getEntry()->getEntryNumber());
+
+    std::vector<Cmper> startingShapes;
+    startEntry.iterateStartingSmartShapes([&](const MusxInstance<others::SmartShape>& shape) {
+        startingShapes.push_back(shape->getCmper());
+        return true;
+    });
+    EXPECT_EQ(startingShapes, index.getStartingShapes(startEntry->getEntry()->getEntryNumber()));
+    EXPECT_NE(std::find(startingShapes.begin(), startingShapes.end(), 4), startingShapes.end());
+
+    EXPECT_EQ(index.getShapesInRange(2, 1, 6), (std::vector<Cmper>{ 1, 4 }));
+    EXPECT_EQ(index.getShapesInRange(2, 3, 3), (std::vector<Cmper>{ 1, 4 }));
+    EXPECT_TRUE(index.getShapesInRange(2, 1, 2).empty());
+    EXPECT_TRUE(index.getShapesInRange(1, 1, 6).empty());
+    EXPECT_FALSE(index.getEndpoints(2));
+    EXPECT_TRUE(index.getStartingShapes(1).empty());
+}
@@ -591,6 +591,34 @@ TEST(StaffTest, AutoNumbering)
     EXPECT_EQ(staff3->addAutoNumbering("Name"), "3. Name");
 }
 
+TEST(StaffTest, AutoNumberingKeepsCollidingUuidsApart)
+{
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(staffXml);
+    auto others = doc->getOthers();
+    ASSERT_TRUE(others);
+
+    // two UUIDs outside the instrument catalog whose interned ids collide
+    const std::string uuidA = "5eed0000-0000-4000-8000-0000000781a9";
+    const std::string uuidB = "5eed0000-0000-4000-8000-0000000a7e56";
+    ASSERT_EQ(calcInstrumentId(uuidA), calcInstrumentId(uuidB));
+
+    std::vector<others::Staff*> staves; // in scroll view order
+    for (const Cmper staffId : { 15, 16, 11 }) {
+        auto staff = others->get<others::Staff>(SCORE_PARTID, staffId);
+        ASSERT_TRUE(staff) << "Staff with cmper " << staffId << " not found";
+        staves.push_back(const_cast<others::Staff*>(staff.get()));
+        staves.back()->useAutoNumbering = true;
+    }
+    staves[0]->instUuid = uuidA;
+    staves[1]->instUuid = uuidB;
+    staves[2]->instUuid = uuidA;
+    others::Staff::calcAllAutoNumberValues(doc);
+
+    EXPECT_EQ(staves[0]->autoNumberValue.value_or(-1), 1);
+    EXPECT_FALSE(staves[1]->autoNumberValue.has_value()) << "a single instrument of its kind is not numbered";
+    EXPECT_EQ(staves[2]->autoNumberValue.value_or(-1), 2);
+}
+
 TEST(StaffText, StaffLines)
 {
   constexpr static musxtest::string_view staffLinesXml = R"xml(
@@ -265,6 +265,43 @@ TEST(StaffStyleInstrument, InstrumentChangeIdentityReuseInPart2)
     EXPECT_EQ(instrument->getInstrumentIdentityAt(MusicPoint(6, musx::util::Fraction{})), harpsichordIdentity);
 }
 
+TEST(StaffStyleInstrument, InstrumentChangesAreCached)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "inst_change2.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    auto part1Map = doc->createInstrumentMap(1);
+    const auto* instrument = part1Map.getInstrumentForStaff(1);
+    ASSERT_TRUE(instrument);
+
+    const auto changes = instrument->getChanges();
+    ASSERT_EQ(changes.size(), 6u);
+
+    // an instrument built by hand has no timeline and calculates the same result on demand
+    InstrumentInfo unmapped(doc, 1);
+    unmapped.staves = instrument->staves;
+    unmapped.staffGroupId = instrument->staffGroupId;
+    unmapped.multistaffGroupId = instrument->multistaffGroupId;
+    EXPECT_EQ(unmapped.getChanges().size(), changes.size());
+    EXPECT_EQ(unmapped.getInstrumentIdentities(), instrument->getInstrumentIdentities());
+
+    // results are returned by value, so they outlive the map they came from
+    const auto identity = doc->createInstrumentMap(1).getInstrumentForStaff(1)->getInstrumentIdentityAt(MusicPoint(1, musx::util::Fraction{}));
+    EXPECT_EQ(identity, changes.begin()->second.identity);
+
+    // every point within a span resolves to the identity that starts it
+    for (auto it = changes.begin(); it != changes.end(); ++it) {
+        const auto next = std::next(it);
+        const MeasCmper lastMeas = next == changes.end() ? MeasCmper(it->first.measureId + 2) : MeasCmper(next->first.measureId - 1);
+        for (MeasCmper meas = it->first.measureId; meas <= lastMeas; ++meas) {
+            EXPECT_EQ(instrument->getInstrumentIdentityAt(MusicPoint(meas, musx::util::Fraction{})), it->second.identity)
+                << "measure " << meas;
+        }
+    }
+}
+
 TEST(StaffStyleChange, DetectDifferentScorePart)
 {
     std::vector<char> xml;
@@ -1403,3 +1403,49 @@ TEST(TextsTest, ExpressionsAndTitles)
     EXPECT_TRUE(result);
     EXPECT_EQ(output, "Clarinet in B♭ page: 1 page: 1");
 }
+
+TEST(TextsTest, LyricSyllableSpans)
+{
+    using texts::LyricsVerse;
+
+    std::vector<char> syllXml;
+    musxtest::readFile(musxtest::getInputPath() / "syllables.enigmaxml", syllXml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(syllXml);
+    ASSERT_TRUE(doc);
+
+    auto lyrics = doc->getTexts()->getArray<LyricsVerse>();
+    ASSERT_FALSE(lyrics.empty());
+    auto mutableLyrics = const_cast<LyricsVerse*>(lyrics[0].get());
+    mutableLyrics->text = "^fontid(1)^size(12)^nfx(0)ab^nfx(1)cd^nfx(0)ef gh";
+    mutableLyrics->createSyllableInfo(lyrics[0]);
+
+    ASSERT_EQ(lyrics[0]->syllables.size(), 2);
+    EXPECT_EQ(lyrics[0]->getSyllableText(0), "abcdef");
+    EXPECT_EQ(lyrics[0]->getSyllableText(1), "gh");
+    EXPECT_EQ(lyrics[0]->syllables[1]->syllable, "gh");
+    EXPECT_THROW(lyrics[0]->getSyllableText(2), std::out_of_range);
+
+    std::vector<std::string_view> chunks;
+    std::vector<const musx::util::EnigmaStyles*> styles;
+    EXPECT_TRUE(lyrics[0]->iterateStyleSpansForSyllable(0, [&](std::string_view chunk, const musx::util::EnigmaStyles& chunkStyles) -> bool {
+        chunks.push_back(chunk);
+        styles.push_back(&chunkStyles);
+        return true;
+    }));
+    ASSERT_EQ(chunks.size(), 3);
+    EXPECT_EQ(chunks[0], "ab");
+    EXPECT_EQ(chunks[1], "cd");
+    EXPECT_EQ(chunks[2], "ef");
+    EXPECT_TRUE(styles[1]->font->bold);
+    EXPECT_EQ(styles[0], styles[2]) << "identical styles should be interned";
+
+    size_t count = 0;
+    EXPECT_TRUE(lyrics[0]->iterateStyleSpansForSyllable(1, [&](std::string_view chunk, const musx::util::EnigmaStyles& chunkStyles) -> bool {
+        EXPECT_EQ(chunk, "gh");
+        EXPECT_EQ(&chunkStyles, styles[0]);
+        count++;
+        return true;
+    }));
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(lyrics[0]->iterateStyleSpansForSyllable(2, [](std::string_view, const musx::util::EnigmaStyles&) { return true; }));
+}
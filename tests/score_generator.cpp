@@ -0,0 +1,461 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "musx/factory/PoolFactory.h"
+#include "score_generator.h"
+
+using namespace musx::dom;
+
+namespace musxtest {
+
+namespace {
+
+constexpr int beatsPerMeasure = 4;
+constexpr Edu quarterNote = 1024;
+constexpr Edu eighthNote = quarterNote / 2;
+constexpr Edu halfNote = quarterNote * 2;
+constexpr Cmper maxCmper = std::numeric_limits<Cmper>::max() - 1;
+
+void checkDensity(double density, const char* name)
+{
+    if (!(density >= 0.0 && density <= 1.0)) {
+        throw std::invalid_argument(std::string(name) + " must be in the range [0, 1].");
+    }
+}
+
+std::string escapeXml(const std::string& text)
+{
+    std::string result;
+    result.reserve(text.size());
+    for (const char c : text) {
+        switch (c) {
+        case '&': result += "&amp;"; break;
+        case '<': result += "&lt;"; break;
+        case '>': result += "&gt;"; break;
+        case '"': result += "&quot;"; break;
+        default: result += c; break;
+        }
+    }
+    return result;
+}
+
+void writeElement(std::ostream& out, const musx::xml::XmlElementPtr& element, int depth)
+{
+    const std::string indent(static_cast<size_t>(depth) * 2, ' ');
+    out << indent << '<' << element->getTagName();
+    for (auto attribute = element->getFirstAttribute(); attribute; attribute = attribute->nextAttribute()) {
+        out << ' ' << attribute->getName() << "=\"" << escapeXml(attribute->getValue()) << '"';
+    }
+    bool hasChildElements = false;
+    for (auto child = element->getFirstChildElement(); child; child = child->getNextSibling()) {
+        if (child->getTagName().empty()) {
+            continue; // some backends report text as an unnamed child
+        }
+        if (!hasChildElements) {
+            out << ">\n";
+            hasChildElements = true;
+        }
+        writeElement(out, child, depth + 1);
+    }
+    if (hasChildElements) {
+        out << indent << "</" << element->getTagName() << ">\n";
+    } else if (const auto text = element->getText(); !text.empty()) {
+        out << '>' << escapeXml(text) << "</" << element->getTagName() << ">\n";
+    } else {
+        out << "/>\n";
+    }
+}
+
+/// The parts of an EnigmaXML file that a generated score borrows: its options and the fonts they refer to.
+struct SourceStyle
+{
+    std::string options;    ///< The `<options>` element, or empty.
+    std::string fonts;      ///< The `<fontName>` elements from `<others>`.
+};
+
+SourceStyle loadSourceStyle(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::invalid_argument("Unable to open options source " + path.string());
+    }
+    const std::vector<char> xml((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    musx::xml::rapidxml::Document xmlDocument;
+    xmlDocument.loadFromBuffer(xml.data(), xml.size());
+    const auto root = xmlDocument.getRootElement();
+    if (!root || root->getTagName() != "finale") {
+        throw std::invalid_argument("Options source " + path.string() + " is not EnigmaXML.");
+    }
+
+    SourceStyle result;
+    if (auto options = root->getFirstChildElement("options")) {
+        std::ostringstream out;
+        writeElement(out, options, 1);
+        result.options = out.str();
+    }
+    if (auto others = root->getFirstChildElement("others")) {
+        std::ostringstream out;
+        for (auto font = others->getFirstChildElement("fontName"); font; font = font->getNextSibling("fontName")) {
+            writeElement(out, font, 2);
+        }
+        result.fonts = out.str();
+    }
+    return result;
+}
+
+} // namespace
+
+ScoreGenerator::ScoreGenerator(ScoreSpec spec)
+    : m_spec(std::move(spec))
+{
+    if (m_spec.staves == 0 || m_spec.measures == 0) {
+        throw std::invalid_argument("A generated score needs at least one staff and one measure.");
+    }
+    if (m_spec.layers == 0 || m_spec.layers > size_t(MAX_LAYERS)) {
+        throw std::invalid_argument("The layer count must be between 1 and " + std::to_string(MAX_LAYERS) + ".");
+    }
+    if (m_spec.staves > size_t(std::numeric_limits<StaffCmper>::max())
+        || m_spec.measures > size_t(std::numeric_limits<MeasCmper>::max())
+        || m_spec.parts >= size_t(maxCmper)) {
+        throw std::invalid_argument("The staff, measure, or part count exceeds its Enigma key range.");
+    }
+    // frame cmpers are 16-bit, so this also limits the score size
+    if (m_spec.staves * m_spec.measures * m_spec.layers > size_t(maxCmper)) {
+        throw std::invalid_argument("The score needs more frames than an Enigma frame cmper can address.");
+    }
+    checkDensity(m_spec.tupletDensity, "tupletDensity");
+    checkDensity(m_spec.smartShapeDensity, "smartShapeDensity");
+
+    std::mt19937 random(m_spec.seed);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::uniform_int_distribution<int> pitch(-2, 9);
+
+    EntryNumber nextEntry = 1;
+    Cmper nextFrame = 1;
+    Cmper nextShape = 1;
+    m_frames.reserve(m_spec.staves * m_spec.measures * m_spec.layers);
+    for (size_t staff = 1; staff <= m_spec.staves; ++staff) {
+        for (size_t measure = 1; measure <= m_spec.measures; ++measure) {
+            for (LayerIndex layerIndex = 0; layerIndex < m_spec.layers; ++layerIndex) {
+                PlannedFrame frame;
+                frame.frameId = nextFrame++;
+                frame.staffId = StaffCmper(staff);
+                frame.measureId = MeasCmper(measure);
+                frame.layerIndex = layerIndex;
+                const auto addEntry = [&](Edu duration, bool tupletStart) {
+                    frame.entries.push_back({ nextEntry++, duration, pitch(random), tupletStart });
+                };
+                if (layerIndex == 0) {
+                    for (int beat = 0; beat < beatsPerMeasure; ++beat) {
+                        if (chance(random) < m_spec.tupletDensity) {
+                            addEntry(eighthNote, true);
+                            addEntry(eighthNote, false);
+                            addEntry(eighthNote, false);
+                            ++m_tupletCount;
+                        } else {
+                            addEntry(quarterNote, false);
+                        }
+                    }
+                } else {
+                    addEntry(halfNote, false);
+                    addEntry(halfNote, false);
+                }
+                m_entryCount += frame.entries.size();
+                m_frames.push_back(std::move(frame));
+            }
+            if (chance(random) < m_spec.smartShapeDensity) {
+                if (nextShape > maxCmper) {
+                    throw std::invalid_argument("The score needs more smart shapes than an Enigma cmper can address.");
+                }
+                const auto& layer1 = m_frames[m_frames.size() - m_spec.layers].entries;
+                PlannedShape shape;
+                shape.shapeNumber = nextShape++;
+                shape.staffId = StaffCmper(staff);
+                shape.measureId = MeasCmper(measure);
+                if (shape.shapeNumber % 2) {
+                    shape.startEntry = layer1.front().entryNumber;
+                    shape.endEntry = layer1.back().entryNumber;
+                }
+                m_shapes.push_back(shape);
+            }
+        }
+    }
+}
+
+std::vector<StaffCmper> ScoreGenerator::calcPartStaves(Cmper partId) const
+{
+    std::vector<StaffCmper> result;
+    if (m_spec.staves < m_spec.parts) {
+        result.push_back(StaffCmper((partId - 1) % m_spec.staves + 1));
+        return result;
+    }
+    for (size_t staff = partId; staff <= m_spec.staves; staff += m_spec.parts) {
+        result.push_back(StaffCmper(staff));
+    }
+    return result;
+}
+
+DocumentPtr ScoreGenerator::createDocument() const
+{
+    using ShareMode = EnigmaBase::ShareMode;
+
+    auto session = musx::factory::DocumentFactory::begin();
+    const auto& document = session.getDocument();
+    if (!m_spec.optionsSource.empty()) {
+        // the borrowed options and fonts go through the factory, exactly as they would when loaded from xml
+        const auto style = loadSourceStyle(m_spec.optionsSource);
+        const std::string xml = "<finale>\n" + style.options + "  <others>\n" + style.fonts + "  </others>\n</finale>\n";
+        musx::xml::rapidxml::Document xmlDocument;
+        xmlDocument.loadFromBuffer(xml.data(), xml.size());
+        const auto root = xmlDocument.getRootElement();
+        if (auto options = root->getFirstChildElement("options")) {
+            document->getOptions() = musx::factory::OptionsFactory::create(session.getConstructionContext(), options, document);
+        }
+        document->getOthers() = musx::factory::OthersFactory::create(session.getConstructionContext(),
+            root->getFirstChildElement("others"), document);
+    }
+    auto& othersPool = *document->getOthers();
+    auto& detailsPool = *document->getDetails();
+
+    for (size_t measureId = 1; measureId <= m_spec.measures; ++measureId) {
+        auto measure = std::make_shared<others::Measure>(document, SCORE_PARTID, ShareMode::All, Cmper(measureId));
+        measure->beats = beatsPerMeasure;
+        measure->divBeat = quarterNote;
+        othersPool.add(others::Measure::XmlNodeName, measure);
+    }
+    for (size_t staffId = 1; staffId <= m_spec.staves; ++staffId) {
+        auto staff = std::make_shared<others::Staff>(document, SCORE_PARTID, ShareMode::All, Cmper(staffId));
+        staff->staffLines = 5;
+        staff->lineSpace = 24;
+        othersPool.add(others::Staff::XmlNodeName, staff);
+    }
+    for (Cmper partId = 0; partId <= m_spec.parts; ++partId) {
+        const auto shareMode = partId == SCORE_PARTID ? ShareMode::All : ShareMode::None;
+        std::vector<StaffCmper> staves;
+        if (partId == SCORE_PARTID) {
+            for (size_t staffId = 1; staffId <= m_spec.staves; ++staffId) {
+                staves.push_back(StaffCmper(staffId));
+            }
+        } else {
+            staves = calcPartStaves(partId);
+        }
+        for (size_t index = 0; index < staves.size(); ++index) {
+            auto staffUsed = std::make_shared<others::StaffUsed>(document, partId, shareMode, BASE_SYSTEM_ID, Inci(index));
+            staffUsed->staffId = staves[index];
+            othersPool.add(others::StaffUsed::XmlNodeName, staffUsed);
+        }
+        auto partDef = std::make_shared<others::PartDefinition>(document, SCORE_PARTID, ShareMode::All, partId);
+        partDef->partOrder = partId;
+        partDef->extractPart = partId != SCORE_PARTID;
+        othersPool.add(others::PartDefinition::XmlNodeName, partDef);
+        othersPool.add(others::PartGlobals::XmlNodeName,
+            std::make_shared<others::PartGlobals>(document, partId, shareMode, MUSX_GLOBALS_CMPER));
+    }
+
+    std::shared_ptr<details::GFrameHold> gfHold;
+    for (const auto& frame : m_frames) {
+        if (!gfHold || gfHold->getStaff() != frame.staffId || gfHold->getMeasure() != frame.measureId) {
+            gfHold = std::make_shared<details::GFrameHold>(document, SCORE_PARTID, ShareMode::All, frame.staffId, frame.measureId);
+            gfHold->clefId = 0;
+            detailsPool.add(details::GFrameHold::XmlNodeName, gfHold);
+        }
+        gfHold->frames[frame.layerIndex] = frame.frameId;
+
+        auto frameSpec = std::make_shared<others::Frame>(document, SCORE_PARTID, ShareMode::All, frame.frameId);
+        frameSpec->startEntry = frame.entries.front().entryNumber;
+        frameSpec->endEntry = frame.entries.back().entryNumber;
+        othersPool.add(others::Frame::XmlNodeName, frameSpec);
+
+        for (size_t index = 0; index < frame.entries.size(); ++index) {
+            const auto& planned = frame.entries[index];
+            auto entry = std::make_shared<Entry>(document, SCORE_PARTID, ShareMode::All, planned.entryNumber,
+                index > 0 ? frame.entries[index - 1].entryNumber : 0,
+                index + 1 < frame.entries.size() ? frame.entries[index + 1].entryNumber : 0);
+            entry->duration = planned.duration;
+            entry->numNotes = 1;
+            entry->isValid = true;
+            entry->isNote = true;
+            entry->tupletStart = planned.tupletStart;
+            auto note = std::make_shared<Note>(document, 1);
+            note->harmLev = planned.harmLev;
+            note->isValid = true;
+            entry->notes.push_back(note);
+            document->getEntries()->add(planned.entryNumber, entry);
+            if (planned.tupletStart) {
+                auto tuplet = std::make_shared<details::TupletDef>(document, SCORE_PARTID, ShareMode::All, planned.entryNumber, 0);
+                tuplet->displayNumber = 3;
+                tuplet->displayDuration = eighthNote;
+                tuplet->referenceNumber = 2;
+                tuplet->referenceDuration = eighthNote;
+                detailsPool.add(details::TupletDef::XmlNodeName, tuplet);
+            }
+        }
+    }
+
+    std::map<MeasCmper, Inci> measureAssignCounts;
+    for (const auto& planned : m_shapes) {
+        auto shape = std::make_shared<others::SmartShape>(document, SCORE_PARTID, ShareMode::All, planned.shapeNumber);
+        shape->entryBased = planned.startEntry != 0;
+        shape->shapeType = shape->entryBased ? others::SmartShape::ShapeType::SlurAuto : others::SmartShape::ShapeType::Crescendo;
+        const auto createSegment = [&](EntryNumber entryNumber, Edu eduPosition) {
+            auto segment = std::make_shared<others::SmartShape::TerminationSeg>(shape);
+            segment->endPoint = std::make_shared<smartshape::EndPoint>(shape);
+            segment->endPoint->staffId = planned.staffId;
+            segment->endPoint->measId = planned.measureId;
+            segment->endPoint->entryNumber = entryNumber;
+            segment->endPoint->eduPosition = eduPosition;
+            return segment;
+        };
+        shape->startTermSeg = createSegment(planned.startEntry, 0);
+        shape->endTermSeg = createSegment(planned.endEntry, planned.startEntry ? 0 : quarterNote * (beatsPerMeasure - 1));
+        othersPool.add(others::SmartShape::XmlNodeName, shape);
+
+        auto measureAssign = std::make_shared<others::SmartShapeMeasureAssign>(document, SCORE_PARTID, ShareMode::All,
+            planned.measureId, measureAssignCounts[planned.measureId]++);
+        measureAssign->shapeNum = planned.shapeNumber;
+        othersPool.add(others::SmartShapeMeasureAssign::XmlNodeName, measureAssign);
+        if (shape->entryBased) {
+            for (const EntryNumber entryNumber : { planned.startEntry, planned.endEntry }) {
+                auto entryAssign = std::make_shared<details::SmartShapeEntryAssign>(document, SCORE_PARTID, ShareMode::All, entryNumber, 0);
+                entryAssign->shapeNum = planned.shapeNumber;
+                detailsPool.add(details::SmartShapeEntryAssign::XmlNodeName, entryAssign);
+            }
+        }
+    }
+
+    return std::move(session).finish();
+}
+
+std::string ScoreGenerator::createEnigmaXml() const
+{
+    std::ostringstream out;
+    const auto style = m_spec.optionsSource.empty() ? SourceStyle{} : loadSourceStyle(m_spec.optionsSource);
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<finale>\n";
+    out << style.options;
+
+    out << "  <others>\n";
+    out << style.fonts;
+    for (size_t measureId = 1; measureId <= m_spec.measures; ++measureId) {
+        out << "    <measSpec cmper=\"" << measureId << "\"><beats>" << beatsPerMeasure
+            << "</beats><divbeat>" << quarterNote << "</divbeat></measSpec>\n";
+    }
+    for (size_t staffId = 1; staffId <= m_spec.staves; ++staffId) {
+        out << "    <staffSpec cmper=\"" << staffId << "\"><staffLines>5</staffLines><lineSpace>24</lineSpace></staffSpec>\n";
+    }
+    for (Cmper partId = 0; partId <= m_spec.parts; ++partId) {
+        const std::string partAttributes = partId == SCORE_PARTID ? "" : " part=\"" + std::to_string(partId) + "\" shared=\"false\"";
+        std::vector<StaffCmper> staves;
+        if (partId == SCORE_PARTID) {
+            for (size_t staffId = 1; staffId <= m_spec.staves; ++staffId) {
+                staves.push_back(StaffCmper(staffId));
+            }
+        } else {
+            staves = calcPartStaves(partId);
+        }
+        for (size_t index = 0; index < staves.size(); ++index) {
+            out << "    <instUsed cmper=\"" << BASE_SYSTEM_ID << "\" inci=\"" << index << '"' << partAttributes
+                << "><inst>" << staves[index] << "</inst><trackType>staff</trackType></instUsed>\n";
+        }
+        out << "    <partDef cmper=\"" << partId << "\"><partOrder>" << partId << "</partOrder>"
+            << (partId == SCORE_PARTID ? "" : "<extractPart/>") << "</partDef>\n";
+        out << "    <partGlobals cmper=\"" << MUSX_GLOBALS_CMPER << '"' << partAttributes << "/>\n";
+    }
+    for (const auto& frame : m_frames) {
+        out << "    <frameSpec cmper=\"" << frame.frameId << "\"><startEntry>" << frame.entries.front().entryNumber
+            << "</startEntry><endEntry>" << frame.entries.back().entryNumber << "</endEntry></frameSpec>\n";
+    }
+    std::map<MeasCmper, Inci> measureAssignCounts;
+    for (const auto& shape : m_shapes) {
+        const auto writeSegment = [&](const char* tag, EntryNumber entryNumber, Edu eduPosition) {
+            out << "      <" << tag << "><endPt><inst>" << shape.staffId << "</inst><meas>" << shape.measureId << "</meas>";
+            if (entryNumber) {
+                out << "<entryNum>" << entryNumber << "</entryNum>";
+            } else if (eduPosition) {
+                out << "<edu>" << eduPosition << "</edu>";
+            }
+            out << "</endPt></" << tag << ">\n";
+        };
+        out << "    <smartShape cmper=\"" << shape.shapeNumber << "\">\n";
+        out << "      " << (shape.startEntry ? "<shapeType>slurAuto</shapeType><entryBased/>" : "<shapeType>cresc</shapeType>") << '\n';
+        writeSegment("startTermSeg", shape.startEntry, 0);
+        writeSegment("endTermSeg", shape.endEntry, shape.startEntry ? 0 : quarterNote * (beatsPerMeasure - 1));
+        out << "    </smartShape>\n";
+    }
+    for (const auto& shape : m_shapes) {
+        out << "    <smartShapeMeasMark cmper=\"" << shape.measureId << "\" inci=\"" << measureAssignCounts[shape.measureId]++
+            << "\"><shapeNum>" << shape.shapeNumber << "</shapeNum></smartShapeMeasMark>\n";
+    }
+    out << "  </others>\n";
+
+    out << "  <details>\n";
+    for (size_t index = 0; index < m_frames.size(); index += m_spec.layers) {
+        out << "    <gfhold cmper1=\"" << m_frames[index].staffId << "\" cmper2=\"" << m_frames[index].measureId << "\"><clefID>0</clefID>";
+        for (size_t layer = 0; layer < m_spec.layers; ++layer) {
+            out << "<frame" << layer + 1 << '>' << m_frames[index + layer].frameId << "</frame" << layer + 1 << '>';
+        }
+        out << "</gfhold>\n";
+    }
+    for (const auto& frame : m_frames) {
+        for (const auto& entry : frame.entries) {
+            if (entry.tupletStart) {
+                out << "    <tupletDef entnum=\"" << entry.entryNumber << "\" inci=\"0\"><symbolicNum>3</symbolicNum><symbolicDur>"
+                    << eighthNote << "</symbolicDur><refNum>2</refNum><refDur>" << eighthNote << "</refDur></tupletDef>\n";
+            }
+        }
+    }
+    for (const auto& shape : m_shapes) {
+        if (shape.startEntry) {
+            for (const EntryNumber entryNumber : { shape.startEntry, shape.endEntry }) {
+                out << "    <smartShapeEntryMark entnum=\"" << entryNumber << "\" inci=\"0\"><shapeNum>" << shape.shapeNumber
+                    << "</shapeNum></smartShapeEntryMark>\n";
+            }
+        }
+    }
+    out << "  </details>\n";
+
+    out << "  <entries>\n";
+    for (const auto& frame : m_frames) {
+        for (size_t index = 0; index < frame.entries.size(); ++index) {
+            const auto& entry = frame.entries[index];
+            out << "    <entry entnum=\"" << entry.entryNumber
+                << "\" prev=\"" << (index > 0 ? frame.entries[index - 1].entryNumber : 0)
+                << "\" next=\"" << (index + 1 < frame.entries.size() ? frame.entries[index + 1].entryNumber : 0)
+                << "\"><dura>" << entry.duration << "</dura><numNotes>1</numNotes><isValid/><isNote/>"
+                << (entry.tupletStart ? "<tupletStart/>" : "")
+                << "<note id=\"1\"><harmLev>" << entry.harmLev << "</harmLev><isValid/></note></entry>\n";
+        }
+    }
+    out << "  </entries>\n</finale>\n";
+    return out.str();
+}
+
+} // namespace musxtest
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "musx/musx.h"
+
+namespace musxtest {
+
+/// @brief The shape of a generated score. Densities are probabilities in the range [0, 1].
+struct ScoreSpec
+{
+    std::size_t staves = 4;                 ///< Number of staves in the score.
+    std::size_t measures = 16;              ///< Number of 4/4 measures.
+    std::size_t parts = 0;                  ///< Number of linked parts. Staves are dealt to the parts round-robin.
+    std::size_t layers = 1;                 ///< Layers per staff, 1 to @ref musx::dom::MAX_LAYERS.
+    double tupletDensity = 0.0;             ///< Chance that a beat in layer 1 is written as an eighth-note triplet.
+    double smartShapeDensity = 0.0;         ///< Chance that a staff measure receives a slur or hairpin.
+    std::uint32_t seed = 1;                 ///< Seed for the pseudo-random choices, so that the same spec gives the same score.
+    std::filesystem::path optionsSource;    ///< If set, the `<options>` and fonts of this EnigmaXML file are copied into the score.
+};
+
+/**
+ * @brief Generates structurally valid scores of arbitrary size for scalability testing.
+ *
+ * The score is planned once from a @ref ScoreSpec. #createDocument builds the plan directly with
+ * @ref musx::factory::DocumentFactory::ConstructionSession, and #createEnigmaXml emits the same plan as EnigmaXML,
+ * so that the in-memory and the xml load paths can be measured on identical content.
+ *
+ * Each staff measure has one frame per layer. Layer 1 is quarter notes, with triplets as chosen by
+ * ScoreSpec::tupletDensity. Other layers are half notes. Smart shapes alternate between entry-attached
+ * slurs over layer 1 of a measure and measure-attached hairpins.
+ */
+class ScoreGenerator
+{
+public:
+    /// @throws std::invalid_argument if the spec is out of range.
+    explicit ScoreGenerator(ScoreSpec spec);
+
+    /// @brief Builds and finalizes the planned score without xml.
+    [[nodiscard]] musx::dom::DocumentPtr createDocument() const;
+
+    /// @brief Returns the planned score as EnigmaXML.
+    [[nodiscard]] std::string createEnigmaXml() const;
+
+    /// @brief Returns the spec the score was planned from.
+    [[nodiscard]] const ScoreSpec& getSpec() const { return m_spec; }
+
+    [[nodiscard]] std::size_t getEntryCount() const { return m_entryCount; }           ///< Number of planned entries.
+    [[nodiscard]] std::size_t getTupletCount() const { return m_tupletCount; }         ///< Number of planned triplets.
+    [[nodiscard]] std::size_t getSmartShapeCount() const { return m_shapes.size(); }   ///< Number of planned smart shapes.
+
+private:
+    struct PlannedEntry
+    {
+        musx::dom::EntryNumber entryNumber{};
+        musx::dom::Edu duration{};
+        int harmLev{};
+        bool tupletStart{};
+    };
+
+    struct PlannedFrame
+    {
+        musx::dom::Cmper frameId{};
+        musx::dom::StaffCmper staffId{};
+        musx::dom::MeasCmper measureId{};
+        musx::dom::LayerIndex layerIndex{};
+        std::vector<PlannedEntry> entries;
+    };
+
+    struct PlannedShape
+    {
+        musx::dom::Cmper shapeNumber{};
+        musx::dom::StaffCmper staffId{};
+        musx::dom::MeasCmper measureId{};
+        musx::dom::EntryNumber startEntry{};    ///< Zero for a measure-attached hairpin.
+        musx::dom::EntryNumber endEntry{};
+    };
+
+    /// @brief Returns the staves of linked part @p partId in score order.
+    [[nodiscard]] std::vector<musx::dom::StaffCmper> calcPartStaves(musx::dom::Cmper partId) const;
+
+    ScoreSpec m_spec;
+    std::vector<PlannedFrame> m_frames;     ///< In staff, measure, layer order.
+    std::vector<PlannedShape> m_shapes;
+    std::size_t m_entryCount{};
+    std::size_t m_tupletCount{};
+};
+
+} // namespace musxtest
@@ -50,3 +50,54 @@ TEST(Fraction, MaxMin)
     auto maxEduFrac = Fraction::fromEdu(maxEdu);
     EXPECT_EQ(maxEduFrac.calcEduDuration(), maxEdu);
 }
+
+TEST(Fraction, PowerOfTwoReduction)
+{
+    EXPECT_EQ(Fraction(512, 1024), Fraction(1, 2));
+    EXPECT_EQ(Fraction(-768, 1024), Fraction(-3, 4));
+    EXPECT_EQ(Fraction(768, -1024), Fraction(-3, 4));
+    EXPECT_EQ(Fraction(0, 1024), Fraction(0));
+    EXPECT_EQ(Fraction(0, 1024).denominator(), 1);
+    EXPECT_EQ(Fraction(3, 8).denominator(), 8);
+    EXPECT_EQ(Fraction::fromEdu(1536), Fraction(3, 8));
+
+    EXPECT_EQ(Fraction(1, 4) + Fraction(1, 8), Fraction(3, 8));
+    EXPECT_EQ(Fraction(1, 8) + Fraction(1, 4), Fraction(3, 8));
+    EXPECT_EQ(Fraction(3, 8) - Fraction(1, 2), Fraction(-1, 8));
+    EXPECT_EQ(Fraction(1, 2) - Fraction(1, 2), Fraction(0));
+    EXPECT_EQ(Fraction(3, 4) * Fraction(2, 3), Fraction(1, 2));
+    EXPECT_EQ(Fraction(1, 3) + Fraction(1, 6), Fraction(1, 2));
+    EXPECT_EQ(Fraction(1, 4) / Fraction(-3, 2), Fraction(-1, 6));
+    EXPECT_THROW(static_cast<void>(Fraction(1, 4) / Fraction(0)), std::invalid_argument);
+
+    static_assert(Fraction(1, 4) + Fraction(1, 8) == Fraction(3, 8));
+    static_assert(Fraction(2, 3) * Fraction(3, 4) == Fraction(1, 2));
+}
+
+TEST(Fraction, WideIntermediates)
+{
+    // The unreduced products exceed the range of int.
+    EXPECT_EQ(Fraction(100000, 99991) * Fraction(99991, 100000), Fraction(1));
+    EXPECT_EQ(Fraction(1, 60000) + Fraction(1, 60000), Fraction(1, 30000));
+    EXPECT_EQ(Fraction(7, 60000) - Fraction(1, 60000), Fraction(1, 10000));
+    EXPECT_EQ(Fraction(1, 65536) / Fraction(1, 65536), Fraction(1));
+
+    // Adjacent values that are indistinguishable as doubles still compare exactly.
+    constexpr int maxInt = (std::numeric_limits<int>::max)();
+    const Fraction larger(maxInt - 2, maxInt - 1);
+    const Fraction smaller(maxInt - 3, maxInt - 2);
+    EXPECT_TRUE(smaller < larger);
+    EXPECT_FALSE(larger < smaller);
+    EXPECT_TRUE(larger > smaller);
+    EXPECT_TRUE(Fraction(-1, 3) < Fraction(-1, 4));
+}
+
+#ifdef MUSX_CHECKED_FRACTION
+TEST(Fraction, CheckedOverflow)
+{
+    constexpr int maxInt = (std::numeric_limits<int>::max)();
+    EXPECT_THROW(static_cast<void>(Fraction(maxInt) + Fraction(1)), std::overflow_error);
+    EXPECT_THROW(static_cast<void>(Fraction(1, 99991) * Fraction(1, 99989)), std::overflow_error);
+    EXPECT_NO_THROW(static_cast<void>(Fraction(maxInt) - Fraction(1)));
+}
+#endif
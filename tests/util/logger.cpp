@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "musx/musx.h"
+#include "test_utils.h"
+
+using musx::util::AsyncLogSink;
+using musx::util::Logger;
+
+namespace {
+
+struct LoggerRestorer
+{
+    Logger::LogCallback callback = Logger::getCallback();
+    ~LoggerRestorer()
+    {
+        Logger::setCallback(std::move(callback));
+        for (auto level : { Logger::LogLevel::Info, Logger::LogLevel::Warning, Logger::LogLevel::Error, Logger::LogLevel::Verbose }) {
+            Logger::setLevelEnabled(level, true);
+        }
+    }
+};
+
+} // namespace
+
+TEST(LoggerTest, DisabledLevelSkipsFormatting)
+{
+    LoggerRestorer restorer;
+    std::vector<std::string> messages;
+    Logger::setCallback([&](Logger::LogLevel, const std::string& message) { messages.push_back(message); });
+
+    int formatCount = 0;
+    const auto formatter = [&]() { formatCount++; return std::string("formatted"); };
+
+    Logger::setLevelEnabled(Logger::LogLevel::Verbose, false);
+    EXPECT_FALSE(Logger::isLevelEnabled(Logger::LogLevel::Verbose));
+    EXPECT_TRUE(Logger::isLevelEnabled(Logger::LogLevel::Warning));
+    Logger::log(Logger::LogLevel::Verbose, formatter);
+    Logger::log(Logger::LogLevel::Verbose, "plain");
+    EXPECT_EQ(formatCount, 0);
+    EXPECT_TRUE(messages.empty());
+
+    Logger::log(Logger::LogLevel::Warning, formatter);
+    Logger::setLevelEnabled(Logger::LogLevel::Verbose, true);
+    Logger::log(Logger::LogLevel::Verbose, "plain");
+    EXPECT_EQ(formatCount, 1);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0], "formatted");
+    EXPECT_EQ(messages[1], "plain");
+}
+
+TEST(LoggerTest, AsyncSinkDeliversInOrder)
+{
+    LoggerRestorer restorer;
+    constexpr int threadCount = 4;
+    constexpr int messagesPerThread = 500;
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> received(threadCount);
+    {
+        AsyncLogSink sink(threadCount * messagesPerThread, [&](Logger::LogLevel level, const std::string& message) {
+            EXPECT_EQ(level, Logger::LogLevel::Info);
+            const auto colon = message.find(':');
+            std::lock_guard<std::mutex> lock(mutex);
+            received[std::stoi(message.substr(0, colon))].push_back(std::stoi(message.substr(colon + 1)));
+        });
+        Logger::setCallback(sink.createCallback());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([t]() {
+                for (int x = 0; x < messagesPerThread; x++) {
+                    Logger::log(Logger::LogLevel::Info, [&]() { return std::to_string(t) + ":" + std::to_string(x); });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        sink.flush();
+        Logger::setCallback(nullptr);
+        EXPECT_EQ(sink.getDroppedCount(), 0u);
+    }
+    for (const auto& values : received) {
+        ASSERT_EQ(values.size(), size_t(messagesPerThread));
+        EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    }
+}
+
+TEST(LoggerTest, AsyncSinkDropsWhenFull)
+{
+    std::atomic<bool> release{ false };
+    std::atomic<int> delivered{ 0 };
+    size_t pushed = 0;
+    {
+        AsyncLogSink sink(4, [&](Logger::LogLevel, const std::string&) {
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+            delivered++;
+        });
+        EXPECT_EQ(sink.getCapacity(), 4u);
+        for (int x = 0; x < 20; x++) {
+            if (sink.push(Logger::LogLevel::Info, "message")) {
+                pushed++;
+            }
+        }
+        EXPECT_GT(sink.getDroppedCount(), 0u);
+        EXPECT_EQ(pushed + sink.getDroppedCount(), 20u);
+        release = true;
+    }
+    EXPECT_EQ(size_t(delivered.load()), pushed);
+}
+
+TEST(LoggerTest, AsyncSinkFlushWaitsForDelivery)
+{
+    std::atomic<int> delivered{};
+    AsyncLogSink sink(8, [&](Logger::LogLevel, const std::string&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        delivered++;
+    });
+    for (int x = 0; x < 3; x++) {
+        EXPECT_TRUE(sink.push(Logger::LogLevel::Info, "message"));
+    }
+    sink.flush();
+    EXPECT_EQ(delivered.load(), 3) << "flush returned before the last message was delivered";
+}
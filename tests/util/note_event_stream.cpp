@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "musx/musx.h"
+#include "test_utils.h"
+
+using namespace musx::dom;
+using musx::util::Fraction;
+using musx::util::NoteEventStream;
+
+namespace {
+
+// Counts the playable notes that start a tie chain (or are not tied at all) by scanning entries directly.
+size_t countChainStarts(const DocumentPtr& doc)
+{
+    size_t result = 0;
+    doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+        const auto entry = entryInfo->getEntry();
+        if (!entry->isNote || entry->graceNote) {
+            return true;
+        }
+        for (size_t x = 0; x < entry->notes.size(); x++) {
+            NoteInfoPtr noteInfo(entryInfo, x);
+            if (!noteInfo->noPlayback && !(noteInfo->tieEnd && noteInfo.calcTieFrom())) {
+                result++;
+            }
+        }
+        return true;
+    });
+    return result;
+}
+
+} // namespace
+
+TEST(NoteEventStream, TiesMergedAndSorted)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "ties.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::tinyxml2::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    NoteEventStream stream(doc, SCORE_PARTID);
+    const auto events = stream.calcAllEvents();
+    ASSERT_FALSE(events.empty());
+    ASSERT_EQ(events.durations.size(), events.size());
+    ASSERT_EQ(events.staves.size(), events.size());
+    ASSERT_EQ(events.layers.size(), events.size());
+    ASSERT_EQ(events.pitches.size(), events.size());
+    ASSERT_EQ(events.velocities.size(), events.size());
+    EXPECT_EQ(events.size(), countChainStarts(doc));
+
+    const auto& timeline = doc->getGlobalTimeline(SCORE_PARTID);
+    for (size_t x = 0; x < events.size(); x++) {
+        EXPECT_GT(events.durations[x], 0) << "event " << x;
+        EXPECT_LE(events.startTimes[x] + events.durations[x], timeline.getTotalDuration()) << "event " << x;
+        EXPECT_EQ(events.velocities[x], NoteEventStream::DEFAULT_VELOCITY);
+        if (x > 0) {
+            EXPECT_LE(events.startTimes[x - 1], events.startTimes[x]) << "event " << x;
+        }
+    }
+
+    // the first tie in the score is merged into one event that lasts until the end of the tied-to note
+    NoteInfoPtr tieStart;
+    NoteInfoPtr tieEnd;
+    doc->iterateEntries(SCORE_PARTID, [&](const EntryInfoPtr& entryInfo) {
+        const auto entry = entryInfo->getEntry();
+        if (!entry->isNote || entry->graceNote) {
+            return true;
+        }
+        for (size_t x = 0; x < entry->notes.size(); x++) {
+            NoteInfoPtr noteInfo(entryInfo, x);
+            if (noteInfo->tieStart && !noteInfo->tieEnd) {
+                if (auto next = noteInfo.calcTieTo(); next && next->tieEnd) {
+                    tieStart = noteInfo;
+                    tieEnd = next;
+                    return false;
+                }
+            }
+        }
+        return true;
+    });
+    ASSERT_TRUE(tieStart);
+    const auto startTime = timeline.calcAbsolutePosition(tieStart.getEntryInfo());
+    const auto endEntry = tieEnd.getEntryInfo();
+    const auto endTime = timeline.calcAbsolutePosition(endEntry) + endEntry.calcGlobalActualDuration();
+    const int key = NoteEventStream::calcMidiKey(tieStart);
+    bool found = false;
+    for (size_t x = 0; x < events.size(); x++) {
+        if (events.startTimes[x] == startTime && events.staves[x] == tieStart.getEntryInfo().getStaff() && events.pitches[x] == key) {
+            EXPECT_EQ(events.durations[x], endTime - startTime);
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+TEST(NoteEventStream, StreamingMatchesBulk)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "tie_target_types.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::tinyxml2::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    NoteEventStream stream(doc, SCORE_PARTID);
+    const auto bulk = stream.calcAllEvents();
+    size_t index = 0;
+    MeasCmper lastMeasure = 0;
+    stream.iterateMeasures([&](MeasCmper measureId, const NoteEventStream::EventBuffer& buffer) {
+        EXPECT_EQ(measureId, lastMeasure + 1);
+        lastMeasure = measureId;
+        for (size_t x = 0; x < buffer.size(); x++, index++) {
+            if (index >= bulk.size()) {
+                ADD_FAILURE() << "streamed more events than calcAllEvents";
+                return false;
+            }
+            EXPECT_EQ(buffer.startTimes[x], bulk.startTimes[index]);
+            EXPECT_EQ(buffer.durations[x], bulk.durations[index]);
+            EXPECT_EQ(buffer.staves[x], bulk.staves[index]);
+            EXPECT_EQ(buffer.layers[x], bulk.layers[index]);
+            EXPECT_EQ(buffer.pitches[x], bulk.pitches[index]);
+        }
+        return true;
+    });
+    EXPECT_EQ(index, bulk.size());
+    EXPECT_EQ(lastMeasure, doc->getGlobalTimeline(SCORE_PARTID).getMeasureCount());
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "gtest/gtest.h"
+#include "musx/musx.h"
+#include "test_utils.h"
+
+using namespace musx::dom;
+using musx::util::PitchTable;
+
+namespace {
+
+void checkPitchTableMatchesNoteProperties(const std::string& fileName, PitchMode pitchMode, bool checkMidi)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / fileName, xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    NotePropertiesOptions options;
+    options.pitchMode = pitchMode;
+    size_t notesChecked = 0;
+    for (const auto& staffUsed : doc->getScrollViewStaves(SCORE_PARTID)) {
+        const auto table = PitchTable::createForStaff(doc, SCORE_PARTID, staffUsed->staffId, options);
+        size_t row = 0;
+        const auto checkEntry = [&](const EntryInfoPtr& entryInfo) -> bool {
+            if (!entryInfo->getEntry()->isNote) {
+                return true;
+            }
+            for (size_t noteIndex = 0; noteIndex < entryInfo->getEntry()->notes.size(); noteIndex++) {
+                const NoteInfoPtr noteInfo(entryInfo, noteIndex);
+                EXPECT_LT(row, table.size()) << fileName << ": table has too few rows";
+                if (row >= table.size()) return false;
+                const auto expected = noteInfo.calcNoteProperties(options);
+                EXPECT_EQ(table.entryNumbers[row], entryInfo->getEntry()->getEntryNumber());
+                EXPECT_EQ(table.noteIds[row], noteInfo->getNoteId());
+                EXPECT_EQ(music_theory::positiveModulus(table.displacements[row], music_theory::STANDARD_DIATONIC_STEPS), int(expected.noteName))
+                    << fileName << " entry " << table.entryNumbers[row];
+                EXPECT_EQ(table.octaves[row], expected.octave) << fileName << " entry " << table.entryNumbers[row];
+                EXPECT_EQ(table.alterations[row], expected.alteration) << fileName << " entry " << table.entryNumbers[row];
+                EXPECT_EQ(table.staffPositions[row], expected.staffPosition) << fileName << " entry " << table.entryNumbers[row];
+                if (checkMidi) {
+                    const int expectedMidi = (expected.octave + 1) * music_theory::STANDARD_12EDO_STEPS
+                        + music_theory::MAJOR_KEYMAP[size_t(expected.noteName)] + expected.alteration;
+                    EXPECT_EQ(table.midiKeys[row], expectedMidi) << fileName << " entry " << table.entryNumbers[row];
+                }
+                if (pitchMode == PitchMode::Concert) {
+                    EXPECT_EQ(musx::util::NoteEventStream::calcMidiKey(noteInfo), table.midiKeys[row])
+                        << fileName << " entry " << table.entryNumbers[row] << ": note events and pitch table disagree";
+                }
+                row++;
+                notesChecked++;
+            }
+            return true;
+        };
+        const auto measureCount = MeasCmper(doc->getOthers()->getArray<others::Measure>(SCORE_PARTID).size());
+        for (MeasCmper measureId = 1; measureId <= measureCount; measureId++) {
+            if (const auto gfHold = details::GFrameHoldContext(doc, SCORE_PARTID, staffUsed->staffId, measureId)) {
+                gfHold.iterateEntries(checkEntry);
+            }
+        }
+        EXPECT_EQ(row, table.size()) << fileName << ": table has extra rows";
+    }
+    EXPECT_GT(notesChecked, 0u) << fileName;
+}
+
+} // namespace
+
+TEST(PitchTable, MatchesNoteProperties)
+{
+    for (const auto pitchMode : { PitchMode::Concert, PitchMode::Written }) {
+        checkPitchTableMatchesNoteProperties("enharmonics_test.enigmaxml", pitchMode, true);
+        checkPitchTableMatchesNoteProperties("transpose.enigmaxml", pitchMode, true);
+        checkPitchTableMatchesNoteProperties("keysigs.enigmaxml", pitchMode, false);
+        checkPitchTableMatchesNoteProperties("transpose_31edo.enigmaxml", pitchMode, false);
+        checkPitchTableMatchesNoteProperties("drumset.enigmaxml", pitchMode, false);
+    }
+}
+
+TEST(PitchTable, KernelMidiAndEdo)
+{
+    PitchTable::KeyTables tables; // C major 12-EDO
+    const std::vector<uint8_t> written = { 0, 0, 0, 0 };
+    const std::vector<int> clefs = { -10, -10, -10, -10 };
+    const std::vector<uint8_t> fixed = { 0, 0, 0, 1 };
+    const std::vector<int> displacements = { 0, -1, 7, 5 }; // C4, B3, C5, A4
+    std::vector<int> alterations = { 0, -1, 1, 0 };
+    std::vector<int> octaves(4), midiKeys(4);
+    std::vector<int> staffPositions = { 0, 0, 0, 3 };
+    PitchTable::calcPitchColumns(4, tables, written.data(), clefs.data(), fixed.data(), displacements.data(), alterations.data(),
+        octaves.data(), midiKeys.data(), staffPositions.data());
+    EXPECT_EQ(octaves, (std::vector<int>{ 4, 3, 5, 4 }));
+    EXPECT_EQ(midiKeys, (std::vector<int>{ 60, 58, 73, 69 }));
+    EXPECT_EQ(staffPositions, (std::vector<int>{ -10, -11, -3, 3 }));
+
+    // 31-EDO: a quarter-sharp E (one division above E) rounds to E, and C#4 is 2 divisions above C4.
+    tables.edoDivisions = 31;
+    tables.naturalKeyMap = music_theory::calcNaturalKeyMap(31);
+    EXPECT_EQ(tables.naturalKeyMap, (std::array<int, 7>{ 0, 5, 10, 13, 18, 23, 28 }));
+    std::vector<int> displacements31 = { 2, 0 };
+    std::vector<int> alterations31 = { 1, 2 };
+    PitchTable::calcPitchColumns(2, tables, written.data(), clefs.data(), fixed.data(), displacements31.data(), alterations31.data(),
+        octaves.data(), midiKeys.data(), staffPositions.data());
+    EXPECT_EQ(midiKeys[0], 64);
+    EXPECT_EQ(midiKeys[1], 61);
+}
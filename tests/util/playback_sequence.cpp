@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2025, Robert Patterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "musx/musx.h"
+#include "test_utils.h"
+
+using namespace musx::dom;
+using musx::util::PlaybackSequence;
+
+namespace {
+
+using Steps = std::vector<PlaybackSequence::Step>;
+
+// Six measures: a repeat with first and second endings at 3 and 4, Fine at 5 and D.C. al Fine at 6.
+constexpr static musxtest::string_view dcAlFineXml = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<finale>
+  <others>
+    <measSpec cmper="1"><beats>4</beats><divbeat>1024</divbeat><forRepBar/></measSpec>
+    <measSpec cmper="2"><beats>4</beats><divbeat>1024</divbeat></measSpec>
+    <measSpec cmper="3"><beats>4</beats><divbeat>1024</divbeat><bacRepBar/><barEnding/></measSpec>
+    <measSpec cmper="4"><beats>4</beats><divbeat>1024</divbeat><barEnding/></measSpec>
+    <measSpec cmper="5"><beats>4</beats><divbeat>1024</divbeat><txtRepeats/></measSpec>
+    <measSpec cmper="6"><beats>4</beats><divbeat>1024</divbeat><txtRepeats/></measSpec>
+    <repeatBack cmper="3">
+      <actuate>2</actuate>
+    </repeatBack>
+    <repeatEndingStart cmper="3">
+      <trigger>onPass</trigger>
+    </repeatEndingStart>
+    <repeatEndingStart cmper="4">
+      <action>noJump</action>
+      <trigger>onPass</trigger>
+    </repeatEndingStart>
+    <repeatPassList cmper="3">
+      <act>1</act>
+    </repeatPassList>
+    <repeatPassList cmper="4">
+      <act>2</act>
+    </repeatPassList>
+    <textRepeatAssign cmper="5" inci="0">
+      <actuate>2</actuate>
+      <repnum>1</repnum>
+      <action>stop</action>
+      <trigger>onPass</trigger>
+    </textRepeatAssign>
+    <textRepeatAssign cmper="6" inci="0">
+      <target>1</target>
+      <repnum>2</repnum>
+      <action>jumpAbsolute</action>
+    </textRepeatAssign>
+  </others>
+</finale>
+)xml";
+
+Steps collect(PlaybackSequence& sequence)
+{
+    Steps result;
+    while (const auto step = sequence.next()) {
+        result.push_back(*step);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(PlaybackSequence, RepeatsEndingsAndDaCapo)
+{
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::pugi::Document>(dcAlFineXml.data(), dcAlFineXml.size());
+    ASSERT_TRUE(doc);
+
+    const Steps expected = {
+        {1, 1}, {2, 1}, {3, 1},                 // first time through, first ending
+        {1, 2}, {2, 2}, {4, 2},                 // repeat, second ending
+        {5, 2}, {6, 2},                         // Fine is not taken on its first pass
+        {1, 1}, {2, 1}, {4, 1}, {5, 1},         // D.C.: repeats ignored, last ending only, stop at Fine
+    };
+
+    PlaybackSequence sequence(doc, SCORE_PARTID);
+    EXPECT_EQ(sequence.getMeasureCount(), 6);
+    EXPECT_EQ(collect(sequence), expected);
+    EXPECT_FALSE(sequence.next());
+
+    sequence.reset();
+    const auto first = sequence.next();
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first->measureId, 1);
+    EXPECT_EQ(first->pass, 1);
+
+    EXPECT_EQ(PlaybackSequence::calcAll(doc, SCORE_PARTID), expected);
+}
+
+TEST(PlaybackSequence, NoRepeats)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "independent_timesig.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto steps = PlaybackSequence::calcAll(doc, SCORE_PARTID);
+    ASSERT_EQ(steps.size(), 6u);
+    for (size_t index = 0; index < steps.size(); index++) {
+        EXPECT_EQ(steps[index].measureId, MeasCmper(index + 1));
+        EXPECT_EQ(steps[index].pass, 1);
+    }
+}
+
+TEST(PlaybackSequence, MatchesJumpOrigins)
+{
+    std::vector<char> xml;
+    musxtest::readFile(musxtest::getInputPath() / "tie_target_types.enigmaxml", xml);
+    auto doc = musx::factory::DocumentFactory::create<musx::xml::rapidxml::Document>(xml);
+    ASSERT_TRUE(doc);
+
+    const auto steps = PlaybackSequence::calcAll(doc, SCORE_PARTID);
+    ASSERT_FALSE(steps.empty());
+    // every backward jump in the unrolled sequence must be one that calcJumpFromMeasures reports
+    for (size_t index = 1; index < steps.size(); index++) {
+        const auto from = steps[index - 1].measureId;
+        const auto to = steps[index].measureId;
+        if (to <= from) {
+            const auto origins = doc->calcJumpFromMeasures(SCORE_PARTID, to);
+            EXPECT_NE(std::find(origins.begin(), origins.end(), from), origins.end())
+                << "unexpected jump from " << from << " to " << to;
+        }
+    }
+}